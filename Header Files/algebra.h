@@ -6,6 +6,7 @@
 #include <gmp.h>
 #include <gmpxx.h>
 #include <ownerr.h>
+#include <csprng.h>
 
 /* BASIC ADD ALGEBRA */
 mpz_class add(mpz_class num1, mpz_class num2)
@@ -125,16 +126,9 @@ mpz_class generate_random_xbit_number(short int _bit_ = 64)
 {
     try
     { // ** CREATE _bit_ Random Number
-        /* START RAND. GEN. */
-        gmp_randstate_t rand_state;
-        gmp_randinit_default(rand_state);
-
-        /* CREATE _bit_BIT RAND. NUM */
+        /* CREATE _bit_BIT RAND. NUM FROM THE THREAD-LOCAL CSPRNG */
         mpz_class iSecure;
-        mpz_urandomb(iSecure.get_mpz_t(), rand_state, _bit_);
-
-        /* CLEAN RAND GENERATOR */
-        gmp_randclear(rand_state);
+        mpz_urandomb(iSecure.get_mpz_t(), CsprngGmpState(), _bit_);
 
         /* LOG */
         std::clog << "Rand iS Done: " << iSecure << std::endl;
@@ -0,0 +1,124 @@
+// ? Bu dosya, çok sayıda RSA modülünün ortak asal çarpan paylaşıp paylaşmadığını bulan
+// ? Batch GCD algoritmasını (Bernstein: çarpım ağacı + kalan ağacı) içerir.
+// ? Karmaşıklık yarı-doğrusaldır; her ağaç seviyesindeki işlemler thread'lere dağıtılır.
+
+#ifndef BATCHGCD_H
+#define BATCHGCD_H
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <gmp.h>
+#include <gmpxx.h>
+
+/*
+    ParallelFor fonksiyonu [0, count) aralığındaki indeksleri thread'lere dağıtır.
+    Ağaç seviyelerinde işlem boyutları eşit olmadığından indeksler dinamik olarak paylaştırılır.
+*/
+template <typename Function>
+void ParallelFor(size_t count, Function function)
+{
+    size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, count);
+
+    if (threadCount <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+            function(i);
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        workers.emplace_back([&]()
+                             {
+                                 for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+                                     function(i);
+                             });
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+}
+
+/*
+    ProductTree fonksiyonu modüllerden çarpım ağacını oluşturur.
+    tree[0] modüllerin kendisi, tree.back()[0] tüm modüllerin çarpımıdır.
+*/
+std::vector<std::vector<mpz_class>> ProductTree(const std::vector<mpz_class> &moduli)
+{
+    std::vector<std::vector<mpz_class>> tree;
+    tree.push_back(moduli);
+
+    while (tree.back().size() > 1)
+    {
+        const std::vector<mpz_class> &level = tree.back();
+        std::vector<mpz_class> next((level.size() + 1) / 2);
+
+        ParallelFor(next.size(), [&](size_t i)
+                    {
+                        if (2 * i + 1 < level.size())
+                            mpz_mul(next[i].get_mpz_t(), level[2 * i].get_mpz_t(), level[2 * i + 1].get_mpz_t());
+                        else
+                            next[i] = level[2 * i];
+                    });
+
+        tree.push_back(std::move(next));
+    }
+
+    return tree;
+}
+
+/*
+    BatchGCD fonksiyonu her modül için gcd(N_i, P / N_i) değerini hesaplar (P: tüm modüllerin çarpımı).
+    Kalan ağacı yukarıdan aşağı: R_i = R_parent mod N_i^2, sonuç gcd(N_i, R_i / N_i).
+    Üst seviyeler kullanıldıktan sonra serbest bırakılır.
+
+    Parametreler:
+        moduli: Denetlenecek (tekrarsız) modüller.
+
+    Return Değeri:
+        vector<mpz_class>: Her modül için ortak çarpan; 1 ise modül başka hiçbir modülle çarpan paylaşmaz.
+*/
+std::vector<mpz_class> BatchGCD(const std::vector<mpz_class> &moduli)
+{
+    std::vector<mpz_class> result(moduli.size(), 1);
+    if (moduli.size() < 2)
+        return result;
+
+    std::vector<std::vector<mpz_class>> tree = ProductTree(moduli);
+    std::vector<mpz_class> remainders = tree.back();
+    tree.pop_back();
+
+    while (!tree.empty())
+    {
+        const std::vector<mpz_class> &level = tree.back();
+        std::vector<mpz_class> next(level.size());
+
+        ParallelFor(level.size(), [&](size_t i)
+                    {
+                        mpz_class square;
+                        mpz_mul(square.get_mpz_t(), level[i].get_mpz_t(), level[i].get_mpz_t());
+                        mpz_mod(next[i].get_mpz_t(), remainders[i / 2].get_mpz_t(), square.get_mpz_t());
+                    });
+
+        remainders = std::move(next);
+        tree.pop_back();
+    }
+
+    ParallelFor(moduli.size(), [&](size_t i)
+                {
+                    mpz_class quotient;
+                    mpz_divexact(quotient.get_mpz_t(), remainders[i].get_mpz_t(), moduli[i].get_mpz_t());
+                    mpz_gcd(result[i].get_mpz_t(), quotient.get_mpz_t(), moduli[i].get_mpz_t());
+                });
+
+    return result;
+}
+
+#endif // BATCHGCD_H
@@ -0,0 +1,202 @@
+// ? Bu dosya, özel anahtar işlemleri için zamanlama saldırılarına karşı taban körleme (base blinding)
+// ? desteğini içerir. Her anahtar için (r^e, r^-1) çiftlerinden oluşan bir havuz tutulur;
+// ? havuz arka plan thread'i tarafından doldurulur, kullanılan çiftler karesi alınarak yenilenir.
+
+#ifndef BLINDING_H
+#define BLINDING_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include <gmp.h>
+#include <gmpxx.h>
+#include <csprng.h>
+
+// ** Varsayılan havuz boyutu ve bir çiftin kare alınarak kaç kez yeniden kullanılabileceği
+#define BLINDING_POOL_CAPACITY 16
+#define BLINDING_MAX_USES 32
+
+/*
+    BlindingPair: Körleme çifti.
+        blind  : r^e mod n (şifreli metin bununla çarpılır).
+        unblind: r^-1 mod n (sonuç bununla çarpılır).
+        uses   : Bu çiftin (kareleri dahil) kaç kez kullanıldığı.
+*/
+struct BlindingPair
+{
+    mpz_class blind;
+    mpz_class unblind;
+    unsigned uses = 0;
+};
+
+/*
+    BlindingPool: Bir RSA anahtarı için hazır körleme çiftleri havuzu.
+    Acquire() havuzdan bir çift alır (hit); havuz boşsa çifti anında hesaplar (miss).
+    Alınan çiftin karesi (iki modüler çarpma) havuza geri konur; BLINDING_MAX_USES sonrası atılır
+    ve yerini arka plan thread'inin ürettiği yeni çift alır. Böylece ters alma ve üs alma maliyeti
+    istek gecikmesine eklenmez. Birden fazla thread'den aynı anda kullanılabilir.
+*/
+class BlindingPool
+{
+public:
+    BlindingPool(const mpz_class &generator, const mpz_class &publicKey, size_t capacity = BLINDING_POOL_CAPACITY)
+        : generator(generator), publicKey(publicKey), capacity(capacity)
+    {
+        pool.reserve(capacity);
+        worker = std::thread(&BlindingPool::RefillLoop, this);
+    }
+
+    ~BlindingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        worker.join();
+    }
+
+    BlindingPool(const BlindingPool &) = delete;
+    BlindingPool &operator=(const BlindingPool &) = delete;
+
+    // ** Acquire fonksiyonu kullanılmamış bir (r^e, r^-1) çifti döndürür.
+    void Acquire(mpz_class &blind, mpz_class &unblind)
+    {
+        BlindingPair pair;
+        bool hit = false;
+        bool low = false;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!pool.empty())
+            {
+                pair = std::move(pool.back());
+                pool.pop_back();
+                hit = true;
+            }
+            low = pool.size() < capacity / 2;
+        }
+
+        // ** Havuz yarıdan az ise arka plan thread'ini uyandır (her istekte uyandırmamak için)
+        if (low)
+            wake.notify_one();
+
+        if (!hit)
+        {
+            misses.fetch_add(1, std::memory_order_relaxed);
+            pair = Generate();
+        }
+        else
+        {
+            hits.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        blind = pair.blind;
+        unblind = pair.unblind;
+
+        // ** Aynı değerler bir daha kullanılmasın: kare al ve havuza geri koy
+        if (++pair.uses < BLINDING_MAX_USES)
+        {
+            mpz_mul(pair.blind.get_mpz_t(), pair.blind.get_mpz_t(), pair.blind.get_mpz_t());
+            mpz_mod(pair.blind.get_mpz_t(), pair.blind.get_mpz_t(), publicKey.get_mpz_t());
+            mpz_mul(pair.unblind.get_mpz_t(), pair.unblind.get_mpz_t(), pair.unblind.get_mpz_t());
+            mpz_mod(pair.unblind.get_mpz_t(), pair.unblind.get_mpz_t(), publicKey.get_mpz_t());
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (pool.size() < capacity)
+                pool.push_back(std::move(pair));
+        }
+    }
+
+    // ** Havuz metrikleri
+    uint64_t Hits() const { return hits.load(std::memory_order_relaxed); }
+    uint64_t Misses() const { return misses.load(std::memory_order_relaxed); }
+    uint64_t Generated() const { return generated.load(std::memory_order_relaxed); }
+
+    size_t Size()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pool.size();
+    }
+
+private:
+    // ** Generate fonksiyonu gcd(r, n) = 1 olan rastgele r için yeni bir çift hesaplar.
+    BlindingPair Generate()
+    {
+        BlindingPair pair;
+        mpz_class random;
+
+        do
+        {
+            mpz_urandomm(random.get_mpz_t(), CsprngGmpState(), publicKey.get_mpz_t());
+        } while (random < 2 || mpz_invert(pair.unblind.get_mpz_t(), random.get_mpz_t(), publicKey.get_mpz_t()) == 0);
+
+        mpz_powm(pair.blind.get_mpz_t(), random.get_mpz_t(), generator.get_mpz_t(), publicKey.get_mpz_t());
+        generated.fetch_add(1, std::memory_order_relaxed);
+        return pair;
+    }
+
+    // ** Arka plan thread'i: havuz dolana kadar çift üretir, sonra uyur.
+    void RefillLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopping)
+        {
+            if (pool.size() >= capacity)
+            {
+                wake.wait(lock);
+                continue;
+            }
+
+            lock.unlock();
+            BlindingPair pair = Generate();
+            lock.lock();
+
+            if (pool.size() < capacity)
+                pool.push_back(std::move(pair));
+        }
+    }
+
+    const mpz_class generator;
+    const mpz_class publicKey;
+    const size_t capacity;
+
+    std::vector<BlindingPair> pool;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> generated{0};
+
+    std::thread worker;
+};
+
+/*
+    BlindedPowm fonksiyonu result = base^d mod n hesabını körleme ile yapar:
+        m = ((base * r^e)^d mod n) * r^-1 mod n
+    pool nullptr ise körleme yapılmaz.
+*/
+void BlindedPowm(mpz_class &result, mpz_srcptr base, const mpz_class &privateKey, const mpz_class &publicKey, BlindingPool *pool)
+{
+    if (pool == nullptr)
+    {
+        mpz_powm(result.get_mpz_t(), base, privateKey.get_mpz_t(), publicKey.get_mpz_t());
+        return;
+    }
+
+    mpz_class blind, unblind, blinded;
+    pool->Acquire(blind, unblind);
+
+    mpz_mul(blinded.get_mpz_t(), base, blind.get_mpz_t());
+    mpz_mod(blinded.get_mpz_t(), blinded.get_mpz_t(), publicKey.get_mpz_t());
+    mpz_powm(result.get_mpz_t(), blinded.get_mpz_t(), privateKey.get_mpz_t(), publicKey.get_mpz_t());
+    mpz_mul(result.get_mpz_t(), result.get_mpz_t(), unblind.get_mpz_t());
+    mpz_mod(result.get_mpz_t(), result.get_mpz_t(), publicKey.get_mpz_t());
+}
+
+#endif // BLINDING_H
@@ -0,0 +1,93 @@
+// ? Bu dosya, RSA bloklarını tek bir hizalı tamponda sabit adımlı (fixed-stride) limb dizileri
+// ? olarak tutan BlockBatch yapısını içerir. vector<mpz_class> yerine kullanılır:
+// ? her blok için ayrı heap ayrımı yoktur ve bloklar bellekte ardışıktır.
+
+#ifndef BLOCKBATCH_H
+#define BLOCKBATCH_H
+
+#include <vector>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <gmp.h>
+#include <gmpxx.h>
+
+// ** Tampon 64 byte (önbellek satırı) hizalı ayrılır
+#define BLOCKBATCH_ALIGNMENT 64
+
+/*
+    BlockBatch: count adet bloğu, her biri stride limb genişliğinde, tek bir tamponda tutar.
+    i. blok Block(i) adresinden başlar; üst limb'ler sıfırdır (little-endian limb sırası, GMP mpn biçimi).
+    Farklı blokları farklı thread'lerden yazmak güvenlidir.
+*/
+class BlockBatch
+{
+public:
+    BlockBatch() = default;
+
+    BlockBatch(size_t count, size_t stride)
+        : count(count), stride(stride),
+          storage((count * stride * sizeof(mp_limb_t) + BLOCKBATCH_ALIGNMENT - 1) / BLOCKBATCH_ALIGNMENT)
+    {
+    }
+
+    // ** Bir modülden küçük değerleri tutmak için gereken blok genişliği (limb)
+    static size_t StrideFor(const mpz_class &modulus)
+    {
+        return std::max<size_t>(1, mpz_size(modulus.get_mpz_t()));
+    }
+
+    size_t Count() const { return count; }
+    size_t Stride() const { return stride; }
+
+    mp_limb_t *Data() { return reinterpret_cast<mp_limb_t *>(storage.data()); }
+    const mp_limb_t *Data() const { return reinterpret_cast<const mp_limb_t *>(storage.data()); }
+
+    // ** İkili G/Ç için tamponun ham boyutu (Data() ile birlikte)
+    size_t ByteSize() const { return count * stride * sizeof(mp_limb_t); }
+
+    mp_limb_t *Block(size_t i) { return Data() + i * stride; }
+    const mp_limb_t *Block(size_t i) const { return Data() + i * stride; }
+
+    /*
+        View fonksiyonu i. bloğu kopyalamadan salt-okunur bir mpz olarak döndürür (mpz_roinit_n).
+        'view' çağıranın yığınında durur; clear edilmez ve blok yaşadığı sürece geçerlidir.
+    */
+    mpz_srcptr View(size_t i, mpz_ptr view) const
+    {
+        return mpz_roinit_n(view, Block(i), static_cast<mp_size_t>(stride));
+    }
+
+    // ** Set fonksiyonu negatif olmayan bir değeri i. bloğa yazar; sığmazsa std::length_error fırlatır.
+    void Set(size_t i, mpz_srcptr value)
+    {
+        size_t limbs = mpz_size(value);
+        if (mpz_sgn(value) < 0 || limbs > stride)
+            throw std::length_error("Value does not fit into BlockBatch stride.");
+
+        mp_limb_t *block = Block(i);
+        if (limbs > 0)
+            std::memcpy(block, mpz_limbs_read(value), limbs * sizeof(mp_limb_t));
+        std::memset(block + limbs, 0, (stride - limbs) * sizeof(mp_limb_t));
+    }
+
+    void SetUi(size_t i, mp_limb_t value)
+    {
+        mp_limb_t *block = Block(i);
+        std::memset(block, 0, stride * sizeof(mp_limb_t));
+        block[0] = value;
+    }
+
+private:
+    struct alignas(BLOCKBATCH_ALIGNMENT) CacheLine
+    {
+        unsigned char bytes[BLOCKBATCH_ALIGNMENT];
+    };
+
+    size_t count = 0;
+    size_t stride = 0;
+    std::vector<CacheLine> storage;
+};
+
+#endif // BLOCKBATCH_H
@@ -0,0 +1,226 @@
+// ? Bu dosya, RFC 8439 ChaCha20 akış şifresinin çekirdek fonksiyonlarını içerir.
+// ? CSPRNG (csprng.h) ve simetrik şifreleme katmanları bu çekirdeği ortak kullanır.
+
+#ifndef CHACHA20_H
+#define CHACHA20_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#define CHACHA20_KEY_BYTES 32
+#define CHACHA20_NONCE_BYTES 12
+#define CHACHA20_BLOCK_BYTES 64
+
+// ** ChaCha20Xor'un tek seferde ürettiği anahtar akışı blok sayısı
+#define CHACHA20_XOR_BLOCKS 16
+
+#define CHACHA20_ROTL(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define CHACHA20_QUARTERROUND(a, b, c, d) \
+    do                                    \
+    {                                     \
+        a += b;                           \
+        d ^= a;                           \
+        d = CHACHA20_ROTL(d, 16);         \
+        c += d;                           \
+        b ^= c;                           \
+        b = CHACHA20_ROTL(b, 12);         \
+        a += b;                           \
+        d ^= a;                           \
+        d = CHACHA20_ROTL(d, 8);          \
+        c += d;                           \
+        b ^= c;                           \
+        b = CHACHA20_ROTL(b, 7);          \
+    } while (0)
+
+// ** Little-endian 32 bit okuma / yazma (platformdan bağımsız)
+uint32_t ChaCha20Load32(const uint8_t *p)
+{
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void ChaCha20Store32(uint8_t *p, uint32_t v)
+{
+    p[0] = static_cast<uint8_t>(v);
+    p[1] = static_cast<uint8_t>(v >> 8);
+    p[2] = static_cast<uint8_t>(v >> 16);
+    p[3] = static_cast<uint8_t>(v >> 24);
+}
+
+/*
+    ChaCha20Init fonksiyonu 16 kelimelik ChaCha20 durumunu anahtar, nonce ve sayaç ile hazırlar.
+
+    Parametreler:
+        state  : Hazırlanacak 16 x 32 bit durum dizisi.
+        key    : 32 byte anahtar.
+        nonce  : 12 byte nonce.
+        counter: Başlangıç blok sayacı.
+*/
+void ChaCha20Init(uint32_t state[16], const uint8_t key[CHACHA20_KEY_BYTES], const uint8_t nonce[CHACHA20_NONCE_BYTES], uint32_t counter)
+{
+    // ** "expand 32-byte k"
+    state[0] = 0x61707865;
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+
+    for (int i = 0; i < 8; ++i)
+        state[4 + i] = ChaCha20Load32(key + 4 * i);
+
+    state[12] = counter;
+    state[13] = ChaCha20Load32(nonce);
+    state[14] = ChaCha20Load32(nonce + 4);
+    state[15] = ChaCha20Load32(nonce + 8);
+}
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+// ** GCC/Clang vektör eklentisi: her kelime 4 bloğun aynı kelimesini taşır (SSE2/NEON'a derlenir)
+#define CHACHA20_WIDE_LANES 4
+typedef uint32_t ChaCha20Vector __attribute__((vector_size(CHACHA20_WIDE_LANES * 4)));
+
+#if defined(__clang__)
+#define CHACHA20_SHUFFLE(a, b, i0, i1, i2, i3) __builtin_shufflevector(a, b, i0, i1, i2, i3)
+#else
+#define CHACHA20_SHUFFLE(a, b, i0, i1, i2, i3) __builtin_shuffle(a, b, ChaCha20Vector{i0, i1, i2, i3})
+#endif
+
+/*
+    ChaCha20BlocksWide fonksiyonu ardışık sayaçlı 4 bloğu SIMD ile aynı anda üretir.
+    out en az 4 * 64 byte olmalıdır; sayaç 4 ilerletilir.
+*/
+void ChaCha20BlocksWide(uint32_t state[16], uint8_t *out)
+{
+    ChaCha20Vector x[16];
+    ChaCha20Vector input[16];
+
+    for (int i = 0; i < 16; ++i)
+        input[i] = ChaCha20Vector{} + state[i];
+    input[12] += ChaCha20Vector{0, 1, 2, 3};
+
+    for (int i = 0; i < 16; ++i)
+        x[i] = input[i];
+
+    for (int round = 0; round < 10; ++round)
+    {
+        CHACHA20_QUARTERROUND(x[0], x[4], x[8], x[12]);
+        CHACHA20_QUARTERROUND(x[1], x[5], x[9], x[13]);
+        CHACHA20_QUARTERROUND(x[2], x[6], x[10], x[14]);
+        CHACHA20_QUARTERROUND(x[3], x[7], x[11], x[15]);
+        CHACHA20_QUARTERROUND(x[0], x[5], x[10], x[15]);
+        CHACHA20_QUARTERROUND(x[1], x[6], x[11], x[12]);
+        CHACHA20_QUARTERROUND(x[2], x[7], x[8], x[13]);
+        CHACHA20_QUARTERROUND(x[3], x[4], x[9], x[14]);
+    }
+
+    for (int i = 0; i < 16; ++i)
+        x[i] += input[i];
+
+    // ** 4x4 transpoz: şeritleri (lane) blok sırasına çevir
+    for (int g = 0; g < 4; ++g)
+    {
+        ChaCha20Vector t0 = CHACHA20_SHUFFLE(x[4 * g], x[4 * g + 1], 0, 4, 1, 5);
+        ChaCha20Vector t1 = CHACHA20_SHUFFLE(x[4 * g], x[4 * g + 1], 2, 6, 3, 7);
+        ChaCha20Vector t2 = CHACHA20_SHUFFLE(x[4 * g + 2], x[4 * g + 3], 0, 4, 1, 5);
+        ChaCha20Vector t3 = CHACHA20_SHUFFLE(x[4 * g + 2], x[4 * g + 3], 2, 6, 3, 7);
+        ChaCha20Vector lanes[4] = {CHACHA20_SHUFFLE(t0, t2, 0, 1, 4, 5), CHACHA20_SHUFFLE(t0, t2, 2, 3, 6, 7),
+                                   CHACHA20_SHUFFLE(t1, t3, 0, 1, 4, 5), CHACHA20_SHUFFLE(t1, t3, 2, 3, 6, 7)};
+
+        for (int lane = 0; lane < 4; ++lane)
+            std::memcpy(out + lane * CHACHA20_BLOCK_BYTES + 16 * g, &lanes[lane], 16);
+    }
+
+    state[12] += CHACHA20_WIDE_LANES;
+}
+#endif
+
+/*
+    ChaCha20Blocks fonksiyonu ardışık 'blocks' adet 64 byte anahtar akışı üretir ve sayacı ilerletir.
+
+    Parametreler:
+        state : ChaCha20Init ile hazırlanmış durum dizisi (sayaç güncellenir).
+        out   : En az blocks * 64 byte uzunluğunda çıktı tamponu.
+        blocks: Üretilecek blok sayısı.
+*/
+void ChaCha20Blocks(uint32_t state[16], uint8_t *out, size_t blocks)
+{
+#if defined(CHACHA20_WIDE_LANES)
+    // ** Mümkün olduğunca 4 bloğu birlikte üret
+    for (; blocks >= CHACHA20_WIDE_LANES; blocks -= CHACHA20_WIDE_LANES, out += CHACHA20_WIDE_LANES * CHACHA20_BLOCK_BYTES)
+        ChaCha20BlocksWide(state, out);
+#endif
+
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        uint32_t x0 = state[0], x1 = state[1], x2 = state[2], x3 = state[3];
+        uint32_t x4 = state[4], x5 = state[5], x6 = state[6], x7 = state[7];
+        uint32_t x8 = state[8], x9 = state[9], x10 = state[10], x11 = state[11];
+        uint32_t x12 = state[12], x13 = state[13], x14 = state[14], x15 = state[15];
+
+        // ** 20 tur = 10 x (sütun turu + köşegen turu)
+        for (int round = 0; round < 10; ++round)
+        {
+            CHACHA20_QUARTERROUND(x0, x4, x8, x12);
+            CHACHA20_QUARTERROUND(x1, x5, x9, x13);
+            CHACHA20_QUARTERROUND(x2, x6, x10, x14);
+            CHACHA20_QUARTERROUND(x3, x7, x11, x15);
+            CHACHA20_QUARTERROUND(x0, x5, x10, x15);
+            CHACHA20_QUARTERROUND(x1, x6, x11, x12);
+            CHACHA20_QUARTERROUND(x2, x7, x8, x13);
+            CHACHA20_QUARTERROUND(x3, x4, x9, x14);
+        }
+
+        uint8_t *block = out + b * CHACHA20_BLOCK_BYTES;
+        ChaCha20Store32(block + 0, x0 + state[0]);
+        ChaCha20Store32(block + 4, x1 + state[1]);
+        ChaCha20Store32(block + 8, x2 + state[2]);
+        ChaCha20Store32(block + 12, x3 + state[3]);
+        ChaCha20Store32(block + 16, x4 + state[4]);
+        ChaCha20Store32(block + 20, x5 + state[5]);
+        ChaCha20Store32(block + 24, x6 + state[6]);
+        ChaCha20Store32(block + 28, x7 + state[7]);
+        ChaCha20Store32(block + 32, x8 + state[8]);
+        ChaCha20Store32(block + 36, x9 + state[9]);
+        ChaCha20Store32(block + 40, x10 + state[10]);
+        ChaCha20Store32(block + 44, x11 + state[11]);
+        ChaCha20Store32(block + 48, x12 + state[12]);
+        ChaCha20Store32(block + 52, x13 + state[13]);
+        ChaCha20Store32(block + 56, x14 + state[14]);
+        ChaCha20Store32(block + 60, x15 + state[15]);
+
+        // ** Blok sayacını ilerlet
+        ++state[12];
+    }
+}
+
+/*
+    ChaCha20Xor fonksiyonu 'in' verisini anahtar akışı ile XOR'layarak 'out' içine yazar.
+    Şifreleme ve şifre çözme aynı işlemdir; in == out olabilir.
+*/
+void ChaCha20Xor(uint32_t state[16], const uint8_t *in, uint8_t *out, size_t len)
+{
+    uint8_t keyStream[CHACHA20_BLOCK_BYTES * CHACHA20_XOR_BLOCKS];
+
+    while (len > 0)
+    {
+        size_t blocks = (len + CHACHA20_BLOCK_BYTES - 1) / CHACHA20_BLOCK_BYTES;
+        if (blocks > CHACHA20_XOR_BLOCKS)
+            blocks = CHACHA20_XOR_BLOCKS;
+
+        ChaCha20Blocks(state, keyStream, blocks);
+
+        size_t n = blocks * CHACHA20_BLOCK_BYTES;
+        if (n > len)
+            n = len;
+
+        for (size_t i = 0; i < n; ++i)
+            out[i] = in[i] ^ keyStream[i];
+
+        in += n;
+        out += n;
+        len -= n;
+    }
+}
+
+#endif // CHACHA20_H
@@ -0,0 +1,255 @@
+// ? Bu dosya, her thread için ayrı ChaCha20 tabanlı kriptografik rastgele sayı üretecini (CSPRNG) içerir.
+// ? Üreteç işletim sisteminin entropi kaynağından (getrandom / RtlGenRandom) tohumlanır,
+// ? çıktıyı tamponlar, fork sonrası kendini yeniden tohumlar ve GMP'ye gmp_randstate_t olarak bağlanır.
+
+#ifndef CSPRNG_H
+#define CSPRNG_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <gmp.h>
+#include <chacha20.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#define SystemFunction036 NTAPI SystemFunction036
+#include <ntsecapi.h>
+#undef SystemFunction036
+#elif defined(__linux__)
+#include <cerrno>
+#include <pthread.h>
+#include <sys/random.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#if defined(__APPLE__)
+#include <sys/random.h>
+#endif
+#endif
+
+// ** Her yenilemede üretilen blok sayısı (16 x 64 = 1 KiB tampon)
+#define CSPRNG_BUFFER_BLOCKS 16
+#define CSPRNG_BUFFER_BYTES (CSPRNG_BUFFER_BLOCKS * CHACHA20_BLOCK_BYTES)
+
+/*
+    OsEntropy fonksiyonu işletim sisteminin entropi kaynağından 'len' byte okur.
+    Kaynak okunamazsa std::runtime_error fırlatır.
+*/
+void OsEntropy(void *buffer, size_t len)
+{
+    uint8_t *out = static_cast<uint8_t *>(buffer);
+
+#if defined(_WIN32)
+    while (len > 0)
+    {
+        ULONG chunk = len > 0x10000 ? 0x10000 : static_cast<ULONG>(len);
+        if (!RtlGenRandom(out, chunk))
+            throw std::runtime_error("RtlGenRandom failed.");
+        out += chunk;
+        len -= chunk;
+    }
+#elif defined(__linux__)
+    while (len > 0)
+    {
+        ssize_t n = getrandom(out, len, 0);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw std::runtime_error("getrandom failed.");
+        }
+        out += n;
+        len -= static_cast<size_t>(n);
+    }
+#else
+    while (len > 0)
+    {
+        size_t chunk = len > 256 ? 256 : len;
+        if (getentropy(out, chunk) != 0)
+            throw std::runtime_error("getentropy failed.");
+        out += chunk;
+        len -= chunk;
+    }
+#endif
+}
+
+// ** Fork sayacı: çocuk süreçte artırılır, thread durumları bu sayaca bakarak yeniden tohumlanır.
+std::atomic<unsigned long> csprngForkGeneration{0};
+
+#if !defined(_WIN32)
+void CsprngOnFork()
+{
+    csprngForkGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+#endif
+
+void CsprngRegisterForkHandler()
+{
+#if !defined(_WIN32)
+    static std::once_flag once;
+    std::call_once(once, []()
+                   { pthread_atfork(nullptr, nullptr, CsprngOnFork); });
+#endif
+}
+
+/*
+    Thread'e özel üreteç durumu.
+        key       : Bir sonraki tampon için ChaCha20 anahtarı (her yenilemede değişir).
+        buffer    : Henüz tüketilmemiş anahtar akışı.
+        position  : Tamponda bir sonraki okunacak byte.
+        generation: Tohumlamanın yapıldığı fork sayacı değeri.
+*/
+struct CsprngThreadState
+{
+    uint8_t key[CHACHA20_KEY_BYTES];
+    uint8_t buffer[CSPRNG_BUFFER_BYTES];
+    size_t position = CSPRNG_BUFFER_BYTES;
+    unsigned long generation = 0;
+    bool seeded = false;
+};
+
+thread_local CsprngThreadState csprngThreadState;
+
+// ** Anahtarı işletim sisteminden yeniden al ve tamponu boşalt.
+void CsprngReseed(CsprngThreadState &state)
+{
+    CsprngRegisterForkHandler();
+    OsEntropy(state.key, sizeof(state.key));
+    std::memset(state.buffer, 0, sizeof(state.buffer));
+    state.position = CSPRNG_BUFFER_BYTES;
+    state.generation = csprngForkGeneration.load(std::memory_order_relaxed);
+    state.seeded = true;
+}
+
+/*
+    CsprngRefill fonksiyonu tamponu yeniden doldurur.
+    "Fast key erasure": üretilen ilk 32 byte bir sonraki anahtar olur ve hemen silinir,
+    böylece bellekteki durum ele geçirilse bile önceki çıktılar geri elde edilemez.
+*/
+void CsprngRefill(CsprngThreadState &state)
+{
+    static const uint8_t nonce[CHACHA20_NONCE_BYTES] = {0};
+    uint32_t chacha[16];
+
+    ChaCha20Init(chacha, state.key, nonce, 0);
+    ChaCha20Blocks(chacha, state.buffer, CSPRNG_BUFFER_BLOCKS);
+
+    std::memcpy(state.key, state.buffer, CHACHA20_KEY_BYTES);
+    std::memset(state.buffer, 0, CHACHA20_KEY_BYTES);
+    std::memset(chacha, 0, sizeof(chacha));
+
+    state.position = CHACHA20_KEY_BYTES;
+}
+
+/*
+    CsprngFill fonksiyonu çağıran thread'in üretecinden 'len' byte rastgele veri üretir.
+    Thread'ler arasında paylaşılan durum yoktur, kilit alınmaz.
+*/
+void CsprngFill(void *buffer, size_t len)
+{
+    CsprngThreadState &state = csprngThreadState;
+    uint8_t *out = static_cast<uint8_t *>(buffer);
+
+    if (!state.seeded || state.generation != csprngForkGeneration.load(std::memory_order_relaxed))
+        CsprngReseed(state);
+
+    while (len > 0)
+    {
+        if (state.position == CSPRNG_BUFFER_BYTES)
+            CsprngRefill(state);
+
+        size_t n = CSPRNG_BUFFER_BYTES - state.position;
+        if (n > len)
+            n = len;
+
+        // ** Kullanılan byte'ları tampondan sil
+        std::memcpy(out, state.buffer + state.position, n);
+        std::memset(state.buffer + state.position, 0, n);
+
+        state.position += n;
+        out += n;
+        len -= n;
+    }
+}
+
+uint64_t CsprngU64()
+{
+    uint64_t value;
+    CsprngFill(&value, sizeof(value));
+    return value;
+}
+
+/*
+    GMP bağlantısı.
+    GMP, gmp_randstate_t içindeki _mp_algdata._mp_lc alanında aşağıdaki düzende fonksiyon
+    göstericileri bekler (gmp-impl.h: gmp_randfnptr_t, GMP 4.2'den beri değişmedi).
+    Durumun kendisi thread'e özel olduğundan tek bir gmp_randstate_t bile birden fazla
+    thread tarafından kilitsiz kullanılabilir; her thread kendi üretecinden okur.
+*/
+typedef __gmp_randstate_struct *CsprngGmpStatePtr;
+
+struct CsprngGmpFunctions
+{
+    void (*randseed_fn)(CsprngGmpStatePtr, mpz_srcptr);
+    void (*randget_fn)(CsprngGmpStatePtr, mp_ptr, unsigned long int);
+    void (*randclear_fn)(CsprngGmpStatePtr);
+    void (*randiset_fn)(CsprngGmpStatePtr, const __gmp_randstate_struct *);
+};
+
+// ** gmp_randseed çağrıları yok sayılır: CSPRNG yalnızca işletim sistemi entropisi ile tohumlanır.
+void CsprngGmpSeed(CsprngGmpStatePtr, mpz_srcptr) {}
+
+void CsprngGmpGet(CsprngGmpStatePtr, mp_ptr rp, unsigned long int nbits)
+{
+    mp_size_t limbs = (nbits + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+    if (limbs == 0)
+        return;
+
+    CsprngFill(rp, limbs * sizeof(mp_limb_t));
+
+    // ** Fazla bitleri temizle
+    unsigned long int extra = nbits % GMP_NUMB_BITS;
+    if (extra != 0)
+        rp[limbs - 1] &= (~static_cast<mp_limb_t>(0)) >> (GMP_NUMB_BITS - extra);
+}
+
+void CsprngGmpClear(CsprngGmpStatePtr) {}
+
+void CsprngGmpInitSet(CsprngGmpStatePtr dst, const __gmp_randstate_struct *src)
+{
+    *dst = *src;
+}
+
+const CsprngGmpFunctions csprngGmpFunctions = {CsprngGmpSeed, CsprngGmpGet, CsprngGmpClear, CsprngGmpInitSet};
+
+/*
+    CsprngRandInit fonksiyonu bir gmp_randstate_t'yi CSPRNG'ye bağlar.
+    mpz_urandomb, mpz_urandomm vb. tüm GMP rastgele fonksiyonları ile kullanılabilir;
+    gmp_randclear ile temizlenebilir (ayrılmış bellek yoktur).
+*/
+void CsprngRandInit(gmp_randstate_t state)
+{
+    state->_mp_seed->_mp_alloc = 0;
+    state->_mp_seed->_mp_size = 0;
+    state->_mp_seed->_mp_d = nullptr;
+    state->_mp_alg = GMP_RAND_ALG_DEFAULT;
+    state->_mp_algdata._mp_lc = const_cast<CsprngGmpFunctions *>(&csprngGmpFunctions);
+}
+
+// ** Sıcak yolda her çağrıda init/clear yapmamak için hazır paylaşılan GMP durumu.
+CsprngGmpStatePtr CsprngGmpState()
+{
+    static __gmp_randstate_struct state = []()
+    {
+        __gmp_randstate_struct s;
+        CsprngRandInit(&s);
+        return s;
+    }();
+    return &state;
+}
+
+#endif // CSPRNG_H
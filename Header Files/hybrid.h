@@ -0,0 +1,411 @@
+// ? Bu dosya, hibrit RSA-KEM + ChaCha20-Poly1305 şifreleme modunu içerir.
+// ? RSA yalnızca mesaj başına bir kez (rastgele r için r^e mod n) kullanılır; veri ChaCha20-Poly1305
+// ? ile parçalar (chunk) halinde akış olarak şifrelenir. Büyük dosyalar bellekte tutulmaz.
+//
+// ? Akış biçimi (tamsayılar little-endian, RSA değeri big-endian):
+// ?     "RSAH" | sürüm (1 byte) | chunkSize (u32) | kemLength (u32) | kem (kemLength byte)
+// ?     Her parça: başlık (u32: uzunluk | son parça için 0x80000000) | şifreli veri | etiket (16 byte)
+// ? Parça başlığı AAD olarak doğrulanır, nonce parça sırasıdır; bu sayede parçaların sırası
+// ? değiştirilemez ve akışın sonu kesilemez.
+
+#ifndef HYBRID_H
+#define HYBRID_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdint>
+#include <cstring>
+#include <gmp.h>
+#include <gmpxx.h>
+#include <ownerr.h>
+#include <chacha20.h>
+#include <poly1305.h>
+#include <sha256.h>
+#include <csprng.h>
+#include <blinding.h>
+
+#define HYBRID_MAGIC "RSAH"
+#define HYBRID_VERSION 1
+#define HYBRID_KEY_BYTES 32
+#define HYBRID_DEFAULT_CHUNK (64 * 1024)
+#define HYBRID_MAX_CHUNK (16 * 1024 * 1024)
+#define HYBRID_FINAL_FLAG 0x80000000u
+
+/*
+    ChaCha20Poly1305Seal fonksiyonu RFC 8439 AEAD şifrelemesi yapar.
+
+    Parametreler:
+        key, nonce: 32 byte anahtar ve 12 byte nonce.
+        aad       : Şifrelenmeyen ama doğrulanan ek veri.
+        in, out   : Düz metin ve şifreli metin tamponları (aynı olabilir).
+        tag       : 16 byte doğrulama etiketi çıktısı.
+*/
+void ChaCha20Poly1305Seal(const uint8_t key[CHACHA20_KEY_BYTES], const uint8_t nonce[CHACHA20_NONCE_BYTES],
+                          const uint8_t *aad, size_t aadLength, const uint8_t *in, uint8_t *out, size_t length,
+                          uint8_t tag[POLY1305_TAG_BYTES])
+{
+    static const uint8_t zeros[POLY1305_BLOCK_BYTES] = {0};
+    uint32_t state[16];
+    uint8_t block0[CHACHA20_BLOCK_BYTES];
+    uint8_t lengths[16];
+    Poly1305Context mac;
+
+    // ** 0. blok Poly1305 anahtarı, şifreleme 1. bloktan başlar
+    ChaCha20Init(state, key, nonce, 0);
+    ChaCha20Blocks(state, block0, 1);
+    ChaCha20Xor(state, in, out, length);
+
+    Poly1305Init(mac, block0);
+    Poly1305Update(mac, aad, aadLength);
+    Poly1305Update(mac, zeros, (POLY1305_BLOCK_BYTES - aadLength % POLY1305_BLOCK_BYTES) % POLY1305_BLOCK_BYTES);
+    Poly1305Update(mac, out, length);
+    Poly1305Update(mac, zeros, (POLY1305_BLOCK_BYTES - length % POLY1305_BLOCK_BYTES) % POLY1305_BLOCK_BYTES);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        lengths[i] = static_cast<uint8_t>(static_cast<uint64_t>(aadLength) >> (8 * i));
+        lengths[8 + i] = static_cast<uint8_t>(static_cast<uint64_t>(length) >> (8 * i));
+    }
+    Poly1305Update(mac, lengths, sizeof(lengths));
+    Poly1305Finish(mac, tag);
+
+    std::memset(state, 0, sizeof(state));
+    std::memset(block0, 0, sizeof(block0));
+}
+
+/*
+    ChaCha20Poly1305Open fonksiyonu etiketi doğrular ve yalnızca doğruysa şifreyi çözer.
+
+    Return Değeri:
+        bool: Etiket doğruysa true; yanlışsa false (out yazılmaz).
+*/
+bool ChaCha20Poly1305Open(const uint8_t key[CHACHA20_KEY_BYTES], const uint8_t nonce[CHACHA20_NONCE_BYTES],
+                          const uint8_t *aad, size_t aadLength, const uint8_t *in, uint8_t *out, size_t length,
+                          const uint8_t tag[POLY1305_TAG_BYTES])
+{
+    static const uint8_t zeros[POLY1305_BLOCK_BYTES] = {0};
+    uint32_t state[16];
+    uint8_t block0[CHACHA20_BLOCK_BYTES];
+    uint8_t lengths[16];
+    uint8_t expected[POLY1305_TAG_BYTES];
+    Poly1305Context mac;
+
+    ChaCha20Init(state, key, nonce, 0);
+    ChaCha20Blocks(state, block0, 1);
+
+    Poly1305Init(mac, block0);
+    Poly1305Update(mac, aad, aadLength);
+    Poly1305Update(mac, zeros, (POLY1305_BLOCK_BYTES - aadLength % POLY1305_BLOCK_BYTES) % POLY1305_BLOCK_BYTES);
+    Poly1305Update(mac, in, length);
+    Poly1305Update(mac, zeros, (POLY1305_BLOCK_BYTES - length % POLY1305_BLOCK_BYTES) % POLY1305_BLOCK_BYTES);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        lengths[i] = static_cast<uint8_t>(static_cast<uint64_t>(aadLength) >> (8 * i));
+        lengths[8 + i] = static_cast<uint8_t>(static_cast<uint64_t>(length) >> (8 * i));
+    }
+    Poly1305Update(mac, lengths, sizeof(lengths));
+    Poly1305Finish(mac, expected);
+
+    bool valid = Poly1305Verify(expected, tag);
+    if (valid)
+        ChaCha20Xor(state, in, out, length);
+
+    std::memset(state, 0, sizeof(state));
+    std::memset(block0, 0, sizeof(block0));
+    return valid;
+}
+
+/*
+    HybridDeriveKey fonksiyonu RSA-KEM gizli değerinden simetrik anahtar türetir.
+    KDF2-SHA256 (ISO 18033-2): key = SHA256(I2OSP(r, nLen) || 00000001)
+*/
+void HybridDeriveKey(const mpz_class &secret, const mpz_class &publicKey, uint8_t key[HYBRID_KEY_BYTES])
+{
+    size_t modulusBytes = (mpz_sizeinbase(publicKey.get_mpz_t(), 2) + 7) / 8;
+    size_t secretBytes = (mpz_sizeinbase(secret.get_mpz_t(), 2) + 7) / 8;
+    std::vector<uint8_t> encoded(modulusBytes, 0);
+    static const uint8_t counter[4] = {0, 0, 0, 1};
+    size_t written = 0;
+
+    // ** Big-endian, modül uzunluğuna sıfırla doldurulmuş
+    if (mpz_sgn(secret.get_mpz_t()) != 0)
+        mpz_export(encoded.data() + (modulusBytes - secretBytes), &written, 1, 1, 1, 0, secret.get_mpz_t());
+
+    Sha256Context ctx;
+    Sha256Init(ctx);
+    Sha256Update(ctx, encoded.data(), encoded.size());
+    Sha256Update(ctx, counter, sizeof(counter));
+    Sha256Final(ctx, key);
+
+    std::memset(encoded.data(), 0, encoded.size());
+}
+
+/*
+    HybridEncapsulate fonksiyonu rastgele r ∈ [2, n-1] seçer, r^e mod n ile sarar ve anahtarı türetir.
+
+    Parametreler:
+        generator: Açık üs (e).
+        publicKey: Modül (n).
+        key      : Türetilen 32 byte simetrik anahtar çıktısı.
+
+    Return Değeri:
+        mpz_class: KEM şifreli değeri (r^e mod n).
+*/
+mpz_class HybridEncapsulate(const mpz_class &generator, const mpz_class &publicKey, uint8_t key[HYBRID_KEY_BYTES])
+{
+    mpz_class secret;
+    mpz_class encapsulated;
+
+    do
+    {
+        mpz_urandomm(secret.get_mpz_t(), CsprngGmpState(), publicKey.get_mpz_t());
+    } while (secret < 2);
+
+    mpz_powm(encapsulated.get_mpz_t(), secret.get_mpz_t(), generator.get_mpz_t(), publicKey.get_mpz_t());
+    HybridDeriveKey(secret, publicKey, key);
+
+    return encapsulated;
+}
+
+// ** HybridDecapsulate fonksiyonu r = c^d mod n değerini (havuz verilirse körlemeli) çözer ve aynı anahtarı türetir.
+void HybridDecapsulate(const mpz_class &encapsulated, const mpz_class &privateKey, const mpz_class &publicKey, uint8_t key[HYBRID_KEY_BYTES],
+                       BlindingPool *blinding = nullptr)
+{
+    mpz_class secret;
+    BlindedPowm(secret, encapsulated.get_mpz_t(), privateKey, publicKey, blinding);
+    HybridDeriveKey(secret, publicKey, key);
+}
+
+// ** Parça nonce'u: 4 byte sıfır + 8 byte little-endian parça sırası
+void HybridChunkNonce(uint64_t index, uint8_t nonce[CHACHA20_NONCE_BYTES])
+{
+    std::memset(nonce, 0, CHACHA20_NONCE_BYTES);
+    for (int i = 0; i < 8; ++i)
+        nonce[4 + i] = static_cast<uint8_t>(index >> (8 * i));
+}
+
+void HybridWrite32(std::ostream &out, uint32_t value)
+{
+    uint8_t bytes[4];
+    ChaCha20Store32(bytes, value);
+    out.write(reinterpret_cast<const char *>(bytes), sizeof(bytes));
+}
+
+uint32_t HybridRead32(std::istream &in)
+{
+    uint8_t bytes[4];
+    if (!in.read(reinterpret_cast<char *>(bytes), sizeof(bytes)))
+        throw std::runtime_error("Hybrid stream is truncated.");
+    return ChaCha20Load32(bytes);
+}
+
+// ** İstenen uzunluk okunana veya akış bitene kadar oku.
+size_t HybridReadFull(std::istream &in, uint8_t *buffer, size_t length)
+{
+    in.read(reinterpret_cast<char *>(buffer), static_cast<std::streamsize>(length));
+    return static_cast<size_t>(in.gcount());
+}
+
+// ** Zarfı metin olarak saklamak için hex kodlama (Config.ini, satır tabanlı çıktı)
+std::string HybridToHex(const std::string &bytes)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(bytes.size() * 2);
+    for (unsigned char byte : bytes)
+    {
+        hex += digits[byte >> 4];
+        hex += digits[byte & 0x0f];
+    }
+    return hex;
+}
+
+// ** Hex çözme; geçersiz karakter veya tek uzunlukta std::invalid_argument fırlatır.
+std::string HybridFromHex(const std::string &hex)
+{
+    if (hex.size() % 2 != 0)
+        throw std::invalid_argument("Hex string has odd length.");
+
+    auto nibble = [](char ch) -> int
+    {
+        if (ch >= '0' && ch <= '9')
+            return ch - '0';
+        if (ch >= 'a' && ch <= 'f')
+            return ch - 'a' + 10;
+        if (ch >= 'A' && ch <= 'F')
+            return ch - 'A' + 10;
+        throw std::invalid_argument("Invalid hex character.");
+    };
+
+    std::string bytes(hex.size() / 2, '\0');
+    for (size_t i = 0; i < bytes.size(); ++i)
+        bytes[i] = static_cast<char>((nibble(hex[2 * i]) << 4) | nibble(hex[2 * i + 1]));
+    return bytes;
+}
+
+/*
+    HybridEncryptStream fonksiyonu 'in' akışını hibrit biçimde şifreleyip 'out' akışına yazar.
+
+    Parametreler:
+        in, out   : Girdi (düz metin) ve çıktı (hibrit zarf) akışları.
+        generator : Açık üs (e).
+        publicKey : Modül (n).
+        chunkSize : Parça boyutu (byte).
+
+    Return Değeri:
+        uint64_t: Şifrelenen düz metin byte sayısı.
+*/
+uint64_t HybridEncryptStream(std::istream &in, std::ostream &out, const mpz_class &generator, const mpz_class &publicKey, size_t chunkSize = HYBRID_DEFAULT_CHUNK)
+{
+    uint64_t total = 0;
+
+    try
+    {
+        if (chunkSize == 0 || chunkSize > HYBRID_MAX_CHUNK)
+            throw std::runtime_error("Invalid hybrid chunk size.");
+
+        uint8_t key[HYBRID_KEY_BYTES];
+        mpz_class encapsulated = HybridEncapsulate(generator, publicKey, key);
+
+        // ** Başlık
+        size_t modulusBytes = (mpz_sizeinbase(publicKey.get_mpz_t(), 2) + 7) / 8;
+        size_t kemBytes = (mpz_sizeinbase(encapsulated.get_mpz_t(), 2) + 7) / 8;
+        std::vector<uint8_t> kem(modulusBytes, 0);
+        size_t written = 0;
+        if (mpz_sgn(encapsulated.get_mpz_t()) != 0)
+            mpz_export(kem.data() + (modulusBytes - kemBytes), &written, 1, 1, 1, 0, encapsulated.get_mpz_t());
+
+        out.write(HYBRID_MAGIC, 4);
+        out.put(static_cast<char>(HYBRID_VERSION));
+        HybridWrite32(out, static_cast<uint32_t>(chunkSize));
+        HybridWrite32(out, static_cast<uint32_t>(kem.size()));
+        out.write(reinterpret_cast<const char *>(kem.data()), static_cast<std::streamsize>(kem.size()));
+
+        // ** Parçalar
+        std::vector<uint8_t> buffer(chunkSize);
+        uint8_t nonce[CHACHA20_NONCE_BYTES];
+        uint8_t header[4];
+        uint8_t tag[POLY1305_TAG_BYTES];
+        uint64_t index = 0;
+        bool final = false;
+
+        while (!final)
+        {
+            size_t length = HybridReadFull(in, buffer.data(), chunkSize);
+            final = length < chunkSize || in.peek() == std::char_traits<char>::eof();
+
+            ChaCha20Store32(header, static_cast<uint32_t>(length) | (final ? HYBRID_FINAL_FLAG : 0));
+            HybridChunkNonce(index++, nonce);
+            ChaCha20Poly1305Seal(key, nonce, header, sizeof(header), buffer.data(), buffer.data(), length, tag);
+
+            out.write(reinterpret_cast<const char *>(header), sizeof(header));
+            out.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(length));
+            out.write(reinterpret_cast<const char *>(tag), sizeof(tag));
+
+            total += length;
+        }
+
+        std::memset(key, 0, sizeof(key));
+
+        if (!out)
+            throw std::runtime_error("Unable to write hybrid stream.");
+
+        return total;
+    }
+    catch (std::exception &ex)
+    { // ** Hibrit şifreleme sırasında bir hata oluştu
+        OwnErr();
+        return total;
+    }
+}
+
+/*
+    HybridDecryptStream fonksiyonu hibrit zarfı doğrular, çözer ve 'out' akışına yazar.
+    Doğrulanmamış veri hiçbir zaman çıktıya yazılmaz; bozuk veya kesilmiş akışta hata verir.
+
+    Parametreler:
+        in, out   : Girdi (hibrit zarf) ve çıktı (düz metin) akışları.
+        privateKey: Özel anahtar (d).
+        publicKey : Modül (n).
+        blinding  : Anahtarın körleme havuzu; nullptr ise körleme yapılmaz.
+
+    Return Değeri:
+        uint64_t: Çözülen düz metin byte sayısı.
+*/
+uint64_t HybridDecryptStream(std::istream &in, std::ostream &out, const mpz_class &privateKey, const mpz_class &publicKey, BlindingPool *blinding = nullptr)
+{
+    uint64_t total = 0;
+
+    try
+    {
+        char magic[4];
+        if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, HYBRID_MAGIC, sizeof(magic)) != 0)
+            throw std::runtime_error("Not a hybrid RSA stream.");
+        if (in.get() != HYBRID_VERSION)
+            throw std::runtime_error("Unsupported hybrid stream version.");
+
+        uint32_t chunkSize = HybridRead32(in);
+        uint32_t kemLength = HybridRead32(in);
+        size_t modulusBytes = (mpz_sizeinbase(publicKey.get_mpz_t(), 2) + 7) / 8;
+        if (chunkSize == 0 || chunkSize > HYBRID_MAX_CHUNK || kemLength != modulusBytes)
+            throw std::runtime_error("Invalid hybrid stream header.");
+
+        std::vector<uint8_t> kem(kemLength);
+        if (HybridReadFull(in, kem.data(), kem.size()) != kem.size())
+            throw std::runtime_error("Hybrid stream is truncated.");
+
+        mpz_class encapsulated;
+        mpz_import(encapsulated.get_mpz_t(), kem.size(), 1, 1, 1, 0, kem.data());
+        if (encapsulated >= publicKey)
+            throw std::runtime_error("Invalid hybrid key encapsulation.");
+
+        uint8_t key[HYBRID_KEY_BYTES];
+        HybridDecapsulate(encapsulated, privateKey, publicKey, key, blinding);
+
+        std::vector<uint8_t> buffer(chunkSize);
+        uint8_t nonce[CHACHA20_NONCE_BYTES];
+        uint8_t header[4];
+        uint8_t tag[POLY1305_TAG_BYTES];
+        uint64_t index = 0;
+        bool final = false;
+
+        while (!final)
+        {
+            if (HybridReadFull(in, header, sizeof(header)) != sizeof(header))
+                throw std::runtime_error("Hybrid stream is truncated.");
+
+            uint32_t word = ChaCha20Load32(header);
+            size_t length = word & ~HYBRID_FINAL_FLAG;
+            final = (word & HYBRID_FINAL_FLAG) != 0;
+
+            if (length > chunkSize || (!final && length != chunkSize))
+                throw std::runtime_error("Invalid hybrid chunk length.");
+            if (HybridReadFull(in, buffer.data(), length) != length || HybridReadFull(in, tag, sizeof(tag)) != sizeof(tag))
+                throw std::runtime_error("Hybrid stream is truncated.");
+
+            HybridChunkNonce(index++, nonce);
+            if (!ChaCha20Poly1305Open(key, nonce, header, sizeof(header), buffer.data(), buffer.data(), length, tag))
+                throw std::runtime_error("Hybrid chunk authentication failed.");
+
+            out.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(length));
+            total += length;
+        }
+
+        std::memset(key, 0, sizeof(key));
+
+        if (!out)
+            throw std::runtime_error("Unable to write decrypted stream.");
+
+        return total;
+    }
+    catch (std::exception &ex)
+    { // ** Hibrit şifre çözme sırasında bir hata oluştu
+        OwnErr();
+        return total;
+    }
+}
+
+#endif // HYBRID_H
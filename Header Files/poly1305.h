@@ -0,0 +1,233 @@
+// ? Bu dosya, RFC 8439 Poly1305 tek kullanımlık mesaj doğrulama kodunu (MAC) içerir.
+// ? 26 bit'lik 5 uzuv (limb) ile 2^130 - 5 modunda çalışır; tüm işlemler sabit zamanlıdır.
+
+#ifndef POLY1305_H
+#define POLY1305_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <chacha20.h>
+
+#define POLY1305_KEY_BYTES 32
+#define POLY1305_TAG_BYTES 16
+#define POLY1305_BLOCK_BYTES 16
+
+/*
+    Poly1305Context: artımlı Poly1305 durumu.
+        r     : Kısıtlanmış (clamped) çarpan.
+        h     : Biriken değer.
+        pad   : Anahtarın ikinci yarısı (s).
+        buffer: Henüz işlenmemiş kısmi blok.
+        used  : buffer içindeki byte sayısı.
+*/
+struct Poly1305Context
+{
+    uint32_t r[5];
+    uint32_t h[5];
+    uint32_t pad[4];
+    uint8_t buffer[POLY1305_BLOCK_BYTES];
+    size_t used;
+};
+
+void Poly1305Init(Poly1305Context &ctx, const uint8_t key[POLY1305_KEY_BYTES])
+{
+    // ** r &= 0xffffffc0ffffffc0ffffffc0fffffff
+    ctx.r[0] = ChaCha20Load32(key + 0) & 0x3ffffff;
+    ctx.r[1] = (ChaCha20Load32(key + 3) >> 2) & 0x3ffff03;
+    ctx.r[2] = (ChaCha20Load32(key + 6) >> 4) & 0x3ffc0ff;
+    ctx.r[3] = (ChaCha20Load32(key + 9) >> 6) & 0x3f03fff;
+    ctx.r[4] = (ChaCha20Load32(key + 12) >> 8) & 0x00fffff;
+
+    for (int i = 0; i < 5; ++i)
+        ctx.h[i] = 0;
+
+    for (int i = 0; i < 4; ++i)
+        ctx.pad[i] = ChaCha20Load32(key + 16 + 4 * i);
+
+    ctx.used = 0;
+}
+
+/*
+    Poly1305Blocks fonksiyonu tam 16 byte'lık blokları işler.
+    hibit: Normal bloklarda 2^128 biti (1 << 24), son kısmi blokta 0.
+*/
+void Poly1305Blocks(Poly1305Context &ctx, const uint8_t *m, size_t bytes, uint32_t hibit)
+{
+    const uint32_t r0 = ctx.r[0], r1 = ctx.r[1], r2 = ctx.r[2], r3 = ctx.r[3], r4 = ctx.r[4];
+    const uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+    uint32_t h0 = ctx.h[0], h1 = ctx.h[1], h2 = ctx.h[2], h3 = ctx.h[3], h4 = ctx.h[4];
+
+    while (bytes >= POLY1305_BLOCK_BYTES)
+    {
+        // ** h += m
+        h0 += ChaCha20Load32(m + 0) & 0x3ffffff;
+        h1 += (ChaCha20Load32(m + 3) >> 2) & 0x3ffffff;
+        h2 += (ChaCha20Load32(m + 6) >> 4) & 0x3ffffff;
+        h3 += (ChaCha20Load32(m + 9) >> 6) & 0x3ffffff;
+        h4 += (ChaCha20Load32(m + 12) >> 8) | hibit;
+
+        // ** h *= r (mod 2^130 - 5)
+        uint64_t d0 = static_cast<uint64_t>(h0) * r0 + static_cast<uint64_t>(h1) * s4 + static_cast<uint64_t>(h2) * s3 +
+                      static_cast<uint64_t>(h3) * s2 + static_cast<uint64_t>(h4) * s1;
+        uint64_t d1 = static_cast<uint64_t>(h0) * r1 + static_cast<uint64_t>(h1) * r0 + static_cast<uint64_t>(h2) * s4 +
+                      static_cast<uint64_t>(h3) * s3 + static_cast<uint64_t>(h4) * s2;
+        uint64_t d2 = static_cast<uint64_t>(h0) * r2 + static_cast<uint64_t>(h1) * r1 + static_cast<uint64_t>(h2) * r0 +
+                      static_cast<uint64_t>(h3) * s4 + static_cast<uint64_t>(h4) * s3;
+        uint64_t d3 = static_cast<uint64_t>(h0) * r3 + static_cast<uint64_t>(h1) * r2 + static_cast<uint64_t>(h2) * r1 +
+                      static_cast<uint64_t>(h3) * r0 + static_cast<uint64_t>(h4) * s4;
+        uint64_t d4 = static_cast<uint64_t>(h0) * r4 + static_cast<uint64_t>(h1) * r3 + static_cast<uint64_t>(h2) * r2 +
+                      static_cast<uint64_t>(h3) * r1 + static_cast<uint64_t>(h4) * r0;
+
+        // ** Kısmi taşıma (carry)
+        uint32_t c = static_cast<uint32_t>(d0 >> 26);
+        h0 = static_cast<uint32_t>(d0) & 0x3ffffff;
+        d1 += c;
+        c = static_cast<uint32_t>(d1 >> 26);
+        h1 = static_cast<uint32_t>(d1) & 0x3ffffff;
+        d2 += c;
+        c = static_cast<uint32_t>(d2 >> 26);
+        h2 = static_cast<uint32_t>(d2) & 0x3ffffff;
+        d3 += c;
+        c = static_cast<uint32_t>(d3 >> 26);
+        h3 = static_cast<uint32_t>(d3) & 0x3ffffff;
+        d4 += c;
+        c = static_cast<uint32_t>(d4 >> 26);
+        h4 = static_cast<uint32_t>(d4) & 0x3ffffff;
+        h0 += c * 5;
+        c = h0 >> 26;
+        h0 &= 0x3ffffff;
+        h1 += c;
+
+        m += POLY1305_BLOCK_BYTES;
+        bytes -= POLY1305_BLOCK_BYTES;
+    }
+
+    ctx.h[0] = h0;
+    ctx.h[1] = h1;
+    ctx.h[2] = h2;
+    ctx.h[3] = h3;
+    ctx.h[4] = h4;
+}
+
+void Poly1305Update(Poly1305Context &ctx, const uint8_t *m, size_t bytes)
+{
+    // ** Önce tampondaki kısmi bloğu tamamla
+    if (ctx.used > 0)
+    {
+        size_t n = POLY1305_BLOCK_BYTES - ctx.used;
+        if (n > bytes)
+            n = bytes;
+
+        std::memcpy(ctx.buffer + ctx.used, m, n);
+        ctx.used += n;
+        m += n;
+        bytes -= n;
+
+        if (ctx.used < POLY1305_BLOCK_BYTES)
+            return;
+
+        Poly1305Blocks(ctx, ctx.buffer, POLY1305_BLOCK_BYTES, 1u << 24);
+        ctx.used = 0;
+    }
+
+    size_t full = bytes & ~static_cast<size_t>(POLY1305_BLOCK_BYTES - 1);
+    if (full > 0)
+    {
+        Poly1305Blocks(ctx, m, full, 1u << 24);
+        m += full;
+        bytes -= full;
+    }
+
+    if (bytes > 0)
+    {
+        std::memcpy(ctx.buffer, m, bytes);
+        ctx.used = bytes;
+    }
+}
+
+void Poly1305Finish(Poly1305Context &ctx, uint8_t tag[POLY1305_TAG_BYTES])
+{
+    // ** Son kısmi blok: 0x01 ekle, sıfırla doldur, 2^128 bitini ekleme
+    if (ctx.used > 0)
+    {
+        ctx.buffer[ctx.used] = 1;
+        std::memset(ctx.buffer + ctx.used + 1, 0, POLY1305_BLOCK_BYTES - ctx.used - 1);
+        Poly1305Blocks(ctx, ctx.buffer, POLY1305_BLOCK_BYTES, 0);
+    }
+
+    uint32_t h0 = ctx.h[0], h1 = ctx.h[1], h2 = ctx.h[2], h3 = ctx.h[3], h4 = ctx.h[4];
+
+    // ** Tam taşıma
+    uint32_t c = h1 >> 26;
+    h1 &= 0x3ffffff;
+    h2 += c;
+    c = h2 >> 26;
+    h2 &= 0x3ffffff;
+    h3 += c;
+    c = h3 >> 26;
+    h3 &= 0x3ffffff;
+    h4 += c;
+    c = h4 >> 26;
+    h4 &= 0x3ffffff;
+    h0 += c * 5;
+    c = h0 >> 26;
+    h0 &= 0x3ffffff;
+    h1 += c;
+
+    // ** g = h + 5 - 2^130; h >= p ise h = g (dallanmasız seçim)
+    uint32_t g0 = h0 + 5;
+    c = g0 >> 26;
+    g0 &= 0x3ffffff;
+    uint32_t g1 = h1 + c;
+    c = g1 >> 26;
+    g1 &= 0x3ffffff;
+    uint32_t g2 = h2 + c;
+    c = g2 >> 26;
+    g2 &= 0x3ffffff;
+    uint32_t g3 = h3 + c;
+    c = g3 >> 26;
+    g3 &= 0x3ffffff;
+    uint32_t g4 = h4 + c - (1u << 26);
+
+    uint32_t mask = (g4 >> 31) - 1;
+    g0 &= mask;
+    g1 &= mask;
+    g2 &= mask;
+    g3 &= mask;
+    g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    // ** h = h % 2^128, ardından tag = h + s
+    h0 = h0 | (h1 << 26);
+    h1 = (h1 >> 6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 << 8);
+
+    uint64_t f = static_cast<uint64_t>(h0) + ctx.pad[0];
+    ChaCha20Store32(tag + 0, static_cast<uint32_t>(f));
+    f = static_cast<uint64_t>(h1) + ctx.pad[1] + (f >> 32);
+    ChaCha20Store32(tag + 4, static_cast<uint32_t>(f));
+    f = static_cast<uint64_t>(h2) + ctx.pad[2] + (f >> 32);
+    ChaCha20Store32(tag + 8, static_cast<uint32_t>(f));
+    f = static_cast<uint64_t>(h3) + ctx.pad[3] + (f >> 32);
+    ChaCha20Store32(tag + 12, static_cast<uint32_t>(f));
+
+    std::memset(&ctx, 0, sizeof(ctx));
+}
+
+// ** Sabit zamanlı etiket karşılaştırması
+bool Poly1305Verify(const uint8_t a[POLY1305_TAG_BYTES], const uint8_t b[POLY1305_TAG_BYTES])
+{
+    uint8_t diff = 0;
+    for (int i = 0; i < POLY1305_TAG_BYTES; ++i)
+        diff |= a[i] ^ b[i];
+    return diff == 0;
+}
+
+#endif // POLY1305_H
@@ -0,0 +1,223 @@
+// ? Bu dosya, RSA anahtar türetme, metin <-> blok dönüşümü, şifreleme ve şifre çözme fonksiyonlarını içerir.
+// ? RSA.cpp ve RSABatch.cpp tarafından ortak kullanılır.
+
+#ifndef RSACORE_H
+#define RSACORE_H
+
+#include <string>
+#include <gmp.h>
+#include <gmpxx.h>
+#include <algebra.h>    // ? GMP işlemlerini kısaltmak için.
+#include <blockbatch.h> // ? Bloklar için tek tamponlu limb dizisi
+#include <blinding.h>   // ? Özel anahtar işlemleri için körleme havuzu
+
+/*
+    Euler Phi fonksiyonu (φ(n)), bir tam sayı n'nin Euler'in totient fonksiyonunu hesaplamak için kullanılır.
+    Bu fonksiyon, n ile aralarında asal olan 1'den küçük pozitif tam sayıların sayısını verir.
+
+    Parametreler:
+        primeOne: Birinci asal sayının bellek adresi.
+        primeTwo: İkinci asal sayının bellek adresi.
+
+    Return Değeri:
+        mpz_class: Hesaplanan φ(n) değeri, bir GMP büyük tam sayı nesnesi olarak döndürülür.
+*/
+mpz_class EulerPhi(mpz_class &primeOne, mpz_class &primeTwo)
+{
+    mpz_class result;
+
+    // ** Asal sayıları birer eksiğine eşitle
+    primeOne = primeOne - 1;
+    primeTwo = primeTwo - 1;
+
+    try
+    {
+        // ** İki asal sayıdan φ(n) değerini hesapla
+        mpz_mul(result.get_mpz_t(), primeOne.get_mpz_t(), primeTwo.get_mpz_t());
+        return result;
+    }
+    catch (std::exception &ex)
+    { // ** Phi değeri hesaplanırken bir hata oluştu
+        OwnErr();
+        return mpz_class();
+    }
+}
+
+/*
+    Private Key fonksiyonu hesaplanmış Phi sonucu ve Üreteç ile özel anahtarı bulur.
+
+    Parametreler:
+        phi      : Hesaplanmış Euler Phi sonucunun bellek adresi.
+        generator: [2, phi-1] aralığında (generator, phi) = 1 olan değerin bellek adresi.
+
+    Return Değeri:
+        mpz_class: Private Key değerini tutan GMP büyük tam sayı nesnesi olarak döndürür.
+*/
+mpz_class PrivateKey(mpz_class &phi, mpz_class &generator)
+{
+    mpz_class coefficientNumber = 1;
+    mpz_class privateKeyModResult{};
+    mpz_class privateKeyResult{};
+    bool condition = true;
+
+    try
+    {
+        do
+        { // ** [ k*φ(n) + 1 ] Generator'a tam bölünmesi için gereken k'yı bulur.
+            privateKeyResult = (multiply(coefficientNumber, phi) + 1);
+            privateKeyModResult = modulus(privateKeyResult, generator);
+
+            if (privateKeyModResult == 0)
+            {
+                condition = false;
+                privateKeyResult = dvide(privateKeyResult, generator);
+            }
+            else
+            {
+                coefficientNumber = coefficientNumber + 1;
+            }
+
+        } while (condition);
+
+        // ** Özel anahtarı döndürür.
+        return privateKeyResult;
+    }
+    catch (std::exception &ex)
+    { // ** Private Key değeri hesaplanırken bir hata oluştu
+        OwnErr();
+        return mpz_class();
+    }
+}
+
+/*
+    Convert Text To Numbers fonksiyonu şifrelenecek Stringi'i alır ve ASCII dizisine çevirir.
+
+    Parametreler:
+        text: ASCII dizisine dönüştürülecek string metinin bellek adresi.
+
+    Return Değeri:
+        BlockBatch: Her karakter için bir blok (1 limb genişliğinde) döndürür.
+*/
+BlockBatch ConvertTextToNumbers(std::string &text)
+{
+    BlockBatch numbers(text.size(), 1);
+
+    try
+    {
+        // ** Text içinde ki her bir Karakteri ASCII dönüştür (UTF-8 byte'ları negatif olmasın diye unsigned)
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            numbers.SetUi(i, static_cast<unsigned char>(text[i]));
+        }
+
+        return numbers;
+    }
+    catch (std::exception &ex)
+    { // ** ConvertTextToNumbers değeri hesaplanırken bir hata oluştu
+        OwnErr();
+        return numbers;
+    }
+}
+
+/*
+    Convert Nubmers To Text fonksiyonu ASCII çevrilmiş vektör dizesini alır Okunabilir hale getirir.
+
+    Parametreler:
+        numbers: ASCII dizisine dönüştürülmüş blokların bellek adresi.
+
+    Return Değeri:
+        string: ASCII olarak dönüştürülmüş bir vektörü okunabilir hale çevirir.
+*/
+std::string ConvertNumbersToText(const BlockBatch &numbers)
+{
+    std::string text;
+    try
+    {
+        text.reserve(numbers.Count());
+
+        // ** Her bloğun en düşük limb'i ASCII karşılığıdır, Karaktere çevir
+        for (size_t i = 0; i < numbers.Count(); ++i)
+        {
+            text += static_cast<char>(numbers.Block(i)[0]);
+        }
+
+        return text;
+    }
+    catch (std::exception &ex)
+    { // ** ConvertNumbersToText değeri hesaplanırken bir hata oluştu
+        OwnErr();
+        return text;
+    }
+}
+
+/*
+    Encrypt fonksiyonu RSA Her bir ASCII karakterini şifreler.
+
+    Parametreler:
+        message  : ASCII çevrilmiş vektörün bellek adresi.
+        generator: Önceden belirlenmiş üreteç değerinin bellek adresi.
+        PublicKey: Özel asal sayıların çarpım değerinin bellek adresi.
+
+    Return Değeri:
+        string: ASCII olarak dönüştürülmüş bir vektörü okunabilir hale çevirir.
+*/
+BlockBatch Encrypt(const BlockBatch &message, const mpz_class &generator, const mpz_class &publicKey)
+{
+    BlockBatch encryptedMessage(message.Count(), BlockBatch::StrideFor(publicKey));
+    mpz_class encrypted;
+    mpz_t view;
+
+    try
+    {
+        for (size_t i = 0; i < message.Count(); ++i)
+        {
+            // ** Bloğu kopyalamadan oku, sonucu aynı sıradaki bloğa yaz
+            mpz_powm(encrypted.get_mpz_t(), message.View(i, view), generator.get_mpz_t(), publicKey.get_mpz_t());
+            encryptedMessage.Set(i, encrypted.get_mpz_t()); // Her sayıyı şifreliyoruz
+        }
+        return encryptedMessage;
+    }
+    catch (std::exception &ex)
+    { // ** Encrypt değeri hesaplanırken bir hata oluştu
+        OwnErr();
+        return encryptedMessage;
+    }
+}
+
+/*
+    Decrypt fonksiyonu RSA ile şifrelenen veriyi özel anahtar ile çözer.
+
+    Parametreler:
+        encryptedMessage: RSA ile şifrelenmiş vektörün bellek adresi.
+        generator       : Önceden belirlenmiş üreteç değerinin bellek adresi.
+        publicKey       : Özel asal sayıların çarpım değerinin bellek adresi.
+        privateKey      : Özel asal sayılar ile @PrivateKey fonksiyonunda hesaplanan değerin bellek adresi.
+        blinding        : Anahtarın körleme havuzu; nullptr ise körleme yapılmaz.
+
+    Return Değeri:
+        string: ASCII olarak dönüştürülmüş bir vektörü okunabilir hale çevirir.
+*/
+BlockBatch Decrypt(const BlockBatch &encryptedMessage, const mpz_class &privateKey, const mpz_class &publicKey, BlindingPool *blinding = nullptr)
+{
+    BlockBatch decryptedMessage(encryptedMessage.Count(), BlockBatch::StrideFor(publicKey));
+    mpz_class decrypted;
+    mpz_t view;
+
+    try
+    {
+        // ** Her sayıyı özel anahtar ile çöz.
+        for (size_t i = 0; i < encryptedMessage.Count(); ++i)
+        {
+            BlindedPowm(decrypted, encryptedMessage.View(i, view), privateKey, publicKey, blinding);
+            decryptedMessage.Set(i, decrypted.get_mpz_t());
+        }
+        return decryptedMessage;
+    }
+    catch (std::exception &ex)
+    { // ** Decrypt değeri hesaplanırken bir hata oluştu
+        OwnErr();
+        return decryptedMessage;
+    }
+}
+
+#endif // RSACORE_H
@@ -0,0 +1,149 @@
+// ? Bu dosya, FIPS 180-4 SHA-256 özet fonksiyonunu içerir (RSA-KEM anahtar türetimi için).
+
+#ifndef SHA256_H
+#define SHA256_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#define SHA256_DIGEST_BYTES 32
+#define SHA256_BLOCK_BYTES 64
+
+#define SHA256_ROTR(v, n) (((v) >> (n)) | ((v) << (32 - (n))))
+
+const uint32_t sha256RoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+/*
+    Sha256Context: artımlı (update/final) SHA-256 durumu.
+        state : Ara özet değeri.
+        buffer: Henüz işlenmemiş kısmi blok.
+        used  : buffer içindeki byte sayısı.
+        length: Toplam işlenen byte sayısı.
+*/
+struct Sha256Context
+{
+    uint32_t state[8];
+    uint8_t buffer[SHA256_BLOCK_BYTES];
+    size_t used;
+    uint64_t length;
+};
+
+void Sha256Compress(uint32_t state[8], const uint8_t block[SHA256_BLOCK_BYTES])
+{
+    uint32_t w[64];
+
+    for (int i = 0; i < 16; ++i)
+        w[i] = (static_cast<uint32_t>(block[4 * i]) << 24) | (static_cast<uint32_t>(block[4 * i + 1]) << 16) |
+               (static_cast<uint32_t>(block[4 * i + 2]) << 8) | static_cast<uint32_t>(block[4 * i + 3]);
+
+    for (int i = 16; i < 64; ++i)
+    {
+        uint32_t s0 = SHA256_ROTR(w[i - 15], 7) ^ SHA256_ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = SHA256_ROTR(w[i - 2], 17) ^ SHA256_ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (int i = 0; i < 64; ++i)
+    {
+        uint32_t s1 = SHA256_ROTR(e, 6) ^ SHA256_ROTR(e, 11) ^ SHA256_ROTR(e, 25);
+        uint32_t ch = (e & f) ^ (~e & g);
+        uint32_t t1 = h + s1 + ch + sha256RoundConstants[i] + w[i];
+        uint32_t s0 = SHA256_ROTR(a, 2) ^ SHA256_ROTR(a, 13) ^ SHA256_ROTR(a, 22);
+        uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+        uint32_t t2 = s0 + maj;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+void Sha256Init(Sha256Context &ctx)
+{
+    static const uint32_t initial[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    std::memcpy(ctx.state, initial, sizeof(initial));
+    ctx.used = 0;
+    ctx.length = 0;
+}
+
+void Sha256Update(Sha256Context &ctx, const void *data, size_t len)
+{
+    const uint8_t *in = static_cast<const uint8_t *>(data);
+    ctx.length += len;
+
+    while (len > 0)
+    {
+        size_t n = SHA256_BLOCK_BYTES - ctx.used;
+        if (n > len)
+            n = len;
+
+        std::memcpy(ctx.buffer + ctx.used, in, n);
+        ctx.used += n;
+        in += n;
+        len -= n;
+
+        if (ctx.used == SHA256_BLOCK_BYTES)
+        {
+            Sha256Compress(ctx.state, ctx.buffer);
+            ctx.used = 0;
+        }
+    }
+}
+
+void Sha256Final(Sha256Context &ctx, uint8_t digest[SHA256_DIGEST_BYTES])
+{
+    uint64_t bitLength = ctx.length * 8;
+
+    // ** 0x80 ve sıfır dolgusu, ardından 64 bit big-endian uzunluk
+    ctx.buffer[ctx.used++] = 0x80;
+    if (ctx.used > SHA256_BLOCK_BYTES - 8)
+    {
+        std::memset(ctx.buffer + ctx.used, 0, SHA256_BLOCK_BYTES - ctx.used);
+        Sha256Compress(ctx.state, ctx.buffer);
+        ctx.used = 0;
+    }
+    std::memset(ctx.buffer + ctx.used, 0, SHA256_BLOCK_BYTES - 8 - ctx.used);
+
+    for (int i = 0; i < 8; ++i)
+        ctx.buffer[SHA256_BLOCK_BYTES - 1 - i] = static_cast<uint8_t>(bitLength >> (8 * i));
+    Sha256Compress(ctx.state, ctx.buffer);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        digest[4 * i] = static_cast<uint8_t>(ctx.state[i] >> 24);
+        digest[4 * i + 1] = static_cast<uint8_t>(ctx.state[i] >> 16);
+        digest[4 * i + 2] = static_cast<uint8_t>(ctx.state[i] >> 8);
+        digest[4 * i + 3] = static_cast<uint8_t>(ctx.state[i]);
+    }
+
+    std::memset(&ctx, 0, sizeof(ctx));
+}
+
+#endif // SHA256_H
@@ -0,0 +1,282 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <gmp.h>
+#include <gmpxx.h>
+#include <ownerr.h>
+#include <configfile.h> // ? Config.INI
+#include <batchgcd.h>   // ? Çarpım ağacı / kalan ağacı
+
+/*
+    KeyAudit: Zayıf anahtar denetimi.
+    Config.ini dosyalarındaki ve anahtarlıklardaki (keyring) RSA modüllerini Batch GCD ile tarar,
+    ortak asal çarpan paylaşan modül çiftlerini ve probPrime.txt içinde tekrar eden asalları raporlar.
+
+    Kullanım:
+        KeyAudit.exe [--primes <dosya>]... [<config.ini | keyring.txt>]...
+        Argüman verilmezse: --primes probPrime.txt Config.ini
+
+        .ini uzantılı dosyalar Config.ini olarak okunur ([Private] PrimeOne * PrimeTwo, yoksa [Public] PublicKey).
+        Diğer dosyalar anahtarlık kabul edilir: her satırın son kelimesi bir modüldür (';' ve '#' yorumdur).
+        --primes dosyalarında her satırın son kelimesi bir asaldır (probPrime.txt biçimi).
+
+    Çıkış Kodu:
+        0: Sorun bulunmadı, 1: Dosya hatası, 2: Paylaşılan çarpan veya tekrar eden asal bulundu.
+*/
+
+/*
+    AuditEntry: Denetlenen bir sayı ve nereden okunduğu.
+        value : Modül veya asal.
+        source: "dosya:satır" ya da "dosya[Bölüm]" biçiminde kaynak.
+*/
+struct AuditEntry
+{
+    mpz_class value;
+    std::string source;
+};
+
+// ** Satır başı/sonundaki boşlukları (CRLF dahil) temizle
+std::string Trim(const std::string &text)
+{
+    size_t begin = text.find_first_not_of(" \t\r\n");
+    if (begin == std::string::npos)
+        return "";
+    size_t end = text.find_last_not_of(" \t\r\n");
+    return text.substr(begin, end - begin + 1);
+}
+
+bool ParseNumber(const std::string &text, mpz_class &value)
+{
+    return !text.empty() && mpz_set_str(value.get_mpz_t(), text.c_str(), 10) == 0 && value > 1;
+}
+
+/*
+    LoadNumberList fonksiyonu her satırın son kelimesini sayı olarak okur.
+
+    Return Değeri:
+        bool: Dosya açılamazsa false.
+*/
+bool LoadNumberList(const std::string &filename, std::vector<AuditEntry> &entries)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+    {
+        std::cerr << "Unable to open file: " << filename << std::endl;
+        return false;
+    }
+
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        ++lineNumber;
+        line = Trim(line);
+        if (line.empty() || line[0] == ';' || line[0] == '#')
+            continue;
+
+        std::string token = line.substr(line.find_last_of(" \t") == std::string::npos ? 0 : line.find_last_of(" \t") + 1);
+        AuditEntry entry;
+        if (!ParseNumber(token, entry.value))
+        {
+            std::cerr << "Skipping invalid number at " << filename << ":" << lineNumber << std::endl;
+            continue;
+        }
+
+        entry.source = filename + ":" + std::to_string(lineNumber);
+        entries.push_back(std::move(entry));
+    }
+
+    return true;
+}
+
+/*
+    LoadConfig fonksiyonu bir Config.ini dosyasından modülü ve asalları okur.
+    RSA.cpp modülü PrimeOne * PrimeTwo olarak hesapladığından asallar varsa onlar kullanılır.
+*/
+bool LoadConfig(const std::string &filename, std::vector<AuditEntry> &moduli, std::vector<AuditEntry> &primes)
+{
+    std::ifstream probe(filename);
+    if (!probe.is_open())
+    {
+        std::cerr << "Unable to open file: " << filename << std::endl;
+        return false;
+    }
+    probe.close();
+
+    std::map<std::string, std::map<std::string, std::string>> iniData = ReadINI(filename);
+
+    AuditEntry primeOne, primeTwo, modulus;
+    bool hasPrimes = ParseNumber(Trim(iniData["Private"]["PrimeOne"]), primeOne.value) &&
+                     ParseNumber(Trim(iniData["Private"]["PrimeTwo"]), primeTwo.value);
+
+    if (hasPrimes)
+    {
+        primeOne.source = filename + "[Private]PrimeOne";
+        primeTwo.source = filename + "[Private]PrimeTwo";
+        modulus.value = primeOne.value * primeTwo.value;
+        modulus.source = filename + "[Private]";
+        primes.push_back(std::move(primeOne));
+        primes.push_back(std::move(primeTwo));
+    }
+    else if (ParseNumber(Trim(iniData["Public"]["PublicKey"]), modulus.value))
+    {
+        modulus.source = filename + "[Public]";
+    }
+    else
+    {
+        std::cerr << "No modulus found in: " << filename << std::endl;
+        return true;
+    }
+
+    moduli.push_back(std::move(modulus));
+    return true;
+}
+
+/*
+    ReportDuplicates fonksiyonu aynı değere sahip girdileri gruplar ve raporlar.
+    Tekrarlar listeden çıkarılır (her değerden bir tane kalır).
+
+    Return Değeri:
+        size_t: Tekrar eden değer sayısı.
+*/
+size_t ReportDuplicates(std::vector<AuditEntry> &entries, const std::string &label)
+{
+    std::sort(entries.begin(), entries.end(), [](const AuditEntry &a, const AuditEntry &b)
+              { return a.value < b.value; });
+
+    std::vector<AuditEntry> unique;
+    size_t duplicates = 0;
+
+    for (size_t i = 0; i < entries.size();)
+    {
+        size_t j = i + 1;
+        while (j < entries.size() && entries[j].value == entries[i].value)
+            ++j;
+
+        if (j - i > 1)
+        {
+            ++duplicates;
+            std::cout << "[DUPLICATE " << label << "] " << entries[i].value << " :";
+            for (size_t k = i; k < j; ++k)
+                std::cout << " " << entries[k].source;
+            std::cout << std::endl;
+        }
+
+        unique.push_back(std::move(entries[i]));
+        i = j;
+    }
+
+    entries = std::move(unique);
+    return duplicates;
+}
+
+/*
+    ReportSharedFactors fonksiyonu Batch GCD ile çarpan paylaşan modülleri bulur.
+    Yalnızca işaretlenen (gcd > 1) modüller kendi aralarında ikili GCD ile eşleştirilir;
+    bu küme normalde çok küçük olduğundan toplam maliyet yarı-doğrusal kalır.
+
+    Return Değeri:
+        size_t: Ortak çarpan paylaşan modül çifti sayısı.
+*/
+size_t ReportSharedFactors(const std::vector<AuditEntry> &moduli)
+{
+    std::vector<mpz_class> values;
+    values.reserve(moduli.size());
+    for (const auto &entry : moduli)
+        values.push_back(entry.value);
+
+    std::vector<mpz_class> factors = BatchGCD(values);
+
+    std::vector<size_t> flagged;
+    for (size_t i = 0; i < factors.size(); ++i)
+        if (factors[i] != 1)
+            flagged.push_back(i);
+
+    std::vector<std::vector<std::string>> reports(flagged.size());
+    ParallelFor(flagged.size(), [&](size_t a)
+                {
+                    mpz_class common;
+                    for (size_t b = a + 1; b < flagged.size(); ++b)
+                    {
+                        mpz_gcd(common.get_mpz_t(), values[flagged[a]].get_mpz_t(), values[flagged[b]].get_mpz_t());
+                        if (common != 1)
+                            reports[a].push_back("[SHARED FACTOR] " + moduli[flagged[a]].source + " <-> " +
+                                                 moduli[flagged[b]].source + " : " + common.get_str());
+                    }
+                });
+
+    size_t pairs = 0;
+    for (const auto &lines : reports)
+        for (const auto &line : lines)
+        {
+            std::cout << line << std::endl;
+            ++pairs;
+        }
+
+    return pairs;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> primeFiles;
+    std::vector<std::string> keyFiles;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "--primes" && i + 1 < argc)
+            primeFiles.push_back(argv[++i]);
+        else
+            keyFiles.push_back(arg);
+    }
+
+    if (argc == 1)
+    {
+        primeFiles.push_back("probPrime.txt");
+        keyFiles.push_back("Config.ini");
+    }
+
+    try
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<AuditEntry> moduli;
+        std::vector<AuditEntry> primes;
+        bool filesOk = true;
+
+        // ** Dosyaları oku
+        for (const auto &filename : primeFiles)
+            filesOk &= LoadNumberList(filename, primes);
+
+        for (const auto &filename : keyFiles)
+        {
+            bool isConfig = filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".ini") == 0;
+            filesOk &= isConfig ? LoadConfig(filename, moduli, primes) : LoadNumberList(filename, moduli);
+        }
+
+        std::cout << "Loaded " << moduli.size() << " moduli and " << primes.size() << " primes." << std::endl;
+
+        // ** Tekrar eden asallar ve modüller, ardından Batch GCD
+        size_t duplicatePrimes = ReportDuplicates(primes, "PRIME");
+        size_t duplicateModuli = ReportDuplicates(moduli, "MODULUS");
+        size_t sharedPairs = ReportSharedFactors(moduli);
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Summary: " << duplicatePrimes << " duplicate primes, " << duplicateModuli << " duplicate moduli, "
+                  << sharedPairs << " moduli pairs sharing a factor (" << seconds << " s)." << std::endl;
+
+        if (!filesOk)
+            return 1;
+        return (duplicatePrimes + duplicateModuli + sharedPairs) > 0 ? 2 : 0;
+    }
+    catch (std::exception &ex)
+    {
+        OwnErr();
+    }
+
+    return 1;
+}
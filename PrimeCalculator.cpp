@@ -1,20 +1,18 @@
 #include <iostream>
 #include <gmpxx.h>
-#include <random>
-#include <chrono>
 #include <fstream>
 #include <string>
 #include <ownerr.h>
+#include <csprng.h>
 
 // ** Istenilen bit uzunluğunda yüksek olasılıkla asal sayı üretir
 // ** Kullanılan algoritma "BPSW" (Bailey–Pomerance–Selfridge–Wagstaff)
 mpz_class GenerateRandomPrime(short int _bit_, short int _validator_)
 {
     mpz_class prime;
-    gmp_randstate_t state;
 
-    gmp_randinit_default(state);
-    gmp_randseed_ui(state, std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    // ** Thread'e özel CSPRNG (csprng.h): her çağrıda init/seed maliyeti yok
+    CsprngGmpStatePtr state = CsprngGmpState();
 
     while (true)
     {
@@ -23,8 +21,6 @@ mpz_class GenerateRandomPrime(short int _bit_, short int _validator_)
             break;
     }
 
-    gmp_randclear(state);
-
     return prime;
 }
 
@@ -46,7 +42,7 @@ void WritePrimesToFile(const std::string &fileName, const mpz_class &prime, shor
     outputFile.close();
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     short int _bit_ = 64;
     short int _count_ = 10;
@@ -55,21 +51,31 @@ int main()
 
     try
     {
-        // ** Bilgilendirici mesajları ekrana yazdır
-        std::cout << "Bit size determines the length of the prime number in bits." << std::endl;
-        std::cout << "Validator size affects the certainty level of the primality test." << std::endl;
-        std::cout << "A higher validator size results in a more rigorous primality check." << std::endl;
+        // ** Etkileşimsiz kullanım: PrimeCalculator.exe <bit> <validator> <count>
+        if (argc == 4)
+        {
+            _bit_ = static_cast<short int>(std::stoi(argv[1]));
+            _validator_ = static_cast<short int>(std::stoi(argv[2]));
+            _count_ = static_cast<short int>(std::stoi(argv[3]));
+        }
+        else
+        {
+            // ** Bilgilendirici mesajları ekrana yazdır
+            std::cout << "Bit size determines the length of the prime number in bits." << std::endl;
+            std::cout << "Validator size affects the certainty level of the primality test." << std::endl;
+            std::cout << "A higher validator size results in a more rigorous primality check." << std::endl;
 
-        // ** Kullanıcıdan bit ve validator boyutunu girmesini isteyen mesajları ekrana yazdır
-        std::cout << "Enter the bit size (recommended: 256): ";
-        std::cin >> _bit_;
+            // ** Kullanıcıdan bit ve validator boyutunu girmesini isteyen mesajları ekrana yazdır
+            std::cout << "Enter the bit size (recommended: 256): ";
+            std::cin >> _bit_;
 
-        std::cout << "Enter the validator size (recommended: 25): ";
-        std::cin >> _validator_;
+            std::cout << "Enter the validator size (recommended: 25): ";
+            std::cin >> _validator_;
 
-        // ** Kaç adet asal sayı isteniyor
-        std::cout << "Enter the prime count (recommended: 10): ";
-        std::cin >> _count_;
+            // ** Kaç adet asal sayı isteniyor
+            std::cout << "Enter the prime count (recommended: 10): ";
+            std::cin >> _count_;
+        }
     }
     catch (std::exception &ex)
     {
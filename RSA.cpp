@@ -1,220 +1,23 @@
 #include <iostream>
 #include <iomanip>
+#include <fstream>
+#include <sstream>
 #include <vector>
 #include <string>
 #include <gmp.h>
 #include <gmpxx.h>
 #include <algebra.h>    // ? GMP işlemlerini kısaltmak için.
 #include <configfile.h> // ? Config.INI
-
-/*
-    Euler Phi fonksiyonu (φ(n)), bir tam sayı n'nin Euler'in totient fonksiyonunu hesaplamak için kullanılır.
-    Bu fonksiyon, n ile aralarında asal olan 1'den küçük pozitif tam sayıların sayısını verir.
-
-    Parametreler:
-        primeOne: Birinci asal sayının bellek adresi.
-        primeTwo: İkinci asal sayının bellek adresi.
-
-    Return Değeri:
-        mpz_class: Hesaplanan φ(n) değeri, bir GMP büyük tam sayı nesnesi olarak döndürülür.
-*/
-mpz_class EulerPhi(mpz_class &primeOne, mpz_class &primeTwo)
-{
-    mpz_class result;
-
-    // ** Asal sayıları birer eksiğine eşitle
-    primeOne = primeOne - 1;
-    primeTwo = primeTwo - 1;
-
-    try
-    {
-        // ** İki asal sayıdan φ(n) değerini hesapla
-        mpz_mul(result.get_mpz_t(), primeOne.get_mpz_t(), primeTwo.get_mpz_t());
-        return result;
-    }
-    catch (std::exception &ex)
-    { // ** Phi değeri hesaplanırken bir hata oluştu
-        OwnErr();
-        return mpz_class();
-    }
-}
-
-/*
-    Private Key fonksiyonu hesaplanmış Phi sonucu ve Üreteç ile özel anahtarı bulur.
-
-    Parametreler:
-        phi      : Hesaplanmış Euler Phi sonucunun bellek adresi.
-        generator: [2, phi-1] aralığında (generator, phi) = 1 olan değerin bellek adresi.
-
-    Return Değeri:
-        mpz_class: Private Key değerini tutan GMP büyük tam sayı nesnesi olarak döndürür.
-*/
-mpz_class PrivateKey(mpz_class &phi, mpz_class &generator)
-{
-    mpz_class coefficientNumber = 1;
-    mpz_class privateKeyModResult{};
-    mpz_class privateKeyResult{};
-    bool condition = true;
-
-    try
-    {
-        do
-        { // ** [ k*φ(n) + 1 ] Generator'a tam bölünmesi için gereken k'yı bulur.
-            privateKeyResult = (multiply(coefficientNumber, phi) + 1);
-            privateKeyModResult = modulus(privateKeyResult, generator);
-
-            if (privateKeyModResult == 0)
-            {
-                condition = false;
-                privateKeyResult = dvide(privateKeyResult, generator);
-            }
-            else
-            {
-                coefficientNumber = coefficientNumber + 1;
-            }
-
-        } while (condition);
-
-        // ** Özel anahtarı döndürür.
-        return privateKeyResult;
-    }
-    catch (std::exception &ex)
-    { // ** Private Key değeri hesaplanırken bir hata oluştu
-        OwnErr();
-        return mpz_class();
-    }
-}
-
-/*
-    Convert Text To Numbers fonksiyonu şifrelenecek Stringi'i alır ve ASCII dizisine çevirir.
-
-    Parametreler:
-        text: ASCII dizisine dönüştürülecek string metinin bellek adresi.
-
-    Return Değeri:
-        mpz_class: ASCII karşılıklarını GMP büyük tamsayı bir vektör olarak döndürür.
-*/
-std::vector<mpz_class> ConvertTextToNumbers(std::string &text)
-{
-    std::vector<mpz_class> numbers;
-
-    try
-    {
-        // ** Text içinde ki her bir Karakteri ASCII dönüştür
-        for (char ch : text)
-        {
-            numbers.push_back(static_cast<int>(ch));
-        }
-
-        return numbers;
-    }
-    catch (std::exception &ex)
-    { // ** ConvertTextToNumbers değeri hesaplanırken bir hata oluştu
-        OwnErr();
-        return numbers;
-    }
-}
-
-/*
-    Convert Nubmers To Text fonksiyonu ASCII çevrilmiş vektör dizesini alır Okunabilir hale getirir.
-
-    Parametreler:
-        numbers: ASCII dizisine dönüştürülmüş elemanları mpz_class türünde bir vektörün bellek adresi.
-
-    Return Değeri:
-        string: ASCII olarak dönüştürülmüş bir vektörü okunabilir hale çevirir.
-*/
-std::string ConvertNumbersToText(const std::vector<mpz_class> &numbers)
-{
-    std::string text;
-    try
-    {
-        // ** Vektör içinde ki ASCII karşılıklarını Karaktere çevir
-        for (const auto &num : numbers)
-        {
-            text += static_cast<char>(mpz_get_ui(num.get_mpz_t()));
-        }
-
-        return text;
-    }
-    catch (std::exception &ex)
-    { // ** ConvertNumbersToText değeri hesaplanırken bir hata oluştu
-        OwnErr();
-        return text;
-    }
-}
-
-/*
-    Encrypt fonksiyonu RSA Her bir ASCII karakterini şifreler.
-
-    Parametreler:
-        message  : ASCII çevrilmiş vektörün bellek adresi.
-        generator: Önceden belirlenmiş üreteç değerinin bellek adresi.
-        PublicKey: Özel asal sayıların çarpım değerinin bellek adresi.
-
-    Return Değeri:
-        string: ASCII olarak dönüştürülmüş bir vektörü okunabilir hale çevirir.
-*/
-std::vector<mpz_class> Encrypt(const std::vector<mpz_class> &message, const mpz_class &generator, const mpz_class &publicKey)
-{
-    std::vector<mpz_class> encryptedMessage;
-    mpz_class encrypted;
-
-    try
-    {
-        for (const auto &num : message)
-        {
-
-            mpz_powm(encrypted.get_mpz_t(), num.get_mpz_t(), generator.get_mpz_t(), publicKey.get_mpz_t());
-            encryptedMessage.push_back(encrypted); // Her sayıyı şifreliyoruz
-        }
-        return encryptedMessage;
-    }
-    catch (std::exception &ex)
-    { // ** Encrypt değeri hesaplanırken bir hata oluştu
-        OwnErr();
-        return encryptedMessage;
-    }
-}
-
-/*
-    Decrypt fonksiyonu RSA ile şifrelenen veriyi özel anahtar ile çözer.
-
-    Parametreler:
-        encryptedMessage: RSA ile şifrelenmiş vektörün bellek adresi.
-        generator       : Önceden belirlenmiş üreteç değerinin bellek adresi.
-        publicKey       : Özel asal sayıların çarpım değerinin bellek adresi.
-        privateKey      : Özel asal sayılar ile @PrivateKey fonksiyonunda hesaplanan değerin bellek adresi.
-
-    Return Değeri:
-        string: ASCII olarak dönüştürülmüş bir vektörü okunabilir hale çevirir.
-*/
-std::vector<mpz_class> Decrypt(const std::vector<mpz_class> &encryptedMessage, const mpz_class &privateKey, const mpz_class &publicKey)
-{
-    std::vector<mpz_class> decryptedMessage;
-    try
-    {
-        // ** Her sayıyı özel anahtar ile çöz.
-        for (const auto &num : encryptedMessage)
-        {
-            mpz_class decrypted;
-            mpz_powm(decrypted.get_mpz_t(), num.get_mpz_t(), privateKey.get_mpz_t(), publicKey.get_mpz_t());
-            decryptedMessage.push_back(decrypted);
-        }
-        return decryptedMessage;
-    }
-    catch (std::exception &ex)
-    { // ** Decrypt değeri hesaplanırken bir hata oluştu
-        OwnErr();
-        return decryptedMessage;
-    }
-}
+#include <hybrid.h>     // ? RSA-KEM + ChaCha20-Poly1305 hibrit mod
+#include <rsacore.h>    // ? EulerPhi, PrivateKey, Encrypt, Decrypt
 
 /*
     Fonksiyonlar:
         WriteTerminal      : Terminale Yazdırmak için kullandığım fonksiyon.
         _add_              : EncryptedText ve DecryptedText Config.ini dosyasına ekler.
         _main_             : RSA için gerekli işlemlerin başlatıldığı fonksiyon.
+        _hybrid_           : Text'i hibrit modda şifreler, zarfı Config.ini dosyasına ekler ve geri çözer.
+        _hybrid_file_      : Bir dosyayı hibrit modda şifreler veya çözer.
         _match_ini_items_  : Config.ini içerisinde ki Text, Generator, PrimeOne, PrimeTwo degerlerini alır.
 
     Parametreler:
@@ -222,11 +25,13 @@ std::vector<mpz_class> Decrypt(const std::vector<mpz_class> &encryptedMessage, c
         decryptedMessage: RSA ile şifresi çözülmüş text'in bellek adresi.
         publicKey       : Özel asal sayıların çarpım değerinin bellek adresi.
         privateKey      : Özel asal sayılar ile @PrivateKey fonksiyonunda hesaplanan değerin bellek adresi.
+        blinding        : Özel anahtar işlemleri için körleme havuzunun bellek adresi.
         filename        : .INI dosyasının ismi Default: Config.INI
+        args            : Komut satırı argümanları (boş ise klasik RSA modu).
         convertedDecryptedMessage: ASCII'den Okunabilir hale çevrilmiş şifresi çözülmüş metinin bellek adresi.
 
 */
-void WriteTerminal(std::vector<mpz_class> &encryptedMsg, const std::string &decryptedMessage)
+void WriteTerminal(const BlockBatch &encryptedMsg, const std::string &decryptedMessage)
 {
     // ** Şifreli metini Hex tabanında terminale yazdırma
     try
@@ -234,9 +39,10 @@ void WriteTerminal(std::vector<mpz_class> &encryptedMsg, const std::string &decr
         std::cout << "\n\n";
         std::cout << "Encrypted Message (Hex): ";
 
-        for (const auto &num : encryptedMsg)
+        mpz_t view;
+        for (size_t i = 0; i < encryptedMsg.Count(); ++i)
         {
-            char *hexStr = mpz_get_str(NULL, 16, num.get_mpz_t());
+            char *hexStr = mpz_get_str(NULL, 16, encryptedMsg.View(i, view));
             // ** Hex türünde yazdır.
             std::cout << hexStr << " ";
             free(hexStr); // Bellek sızıntısını önlemek için belleği serbest bırakın
@@ -257,7 +63,7 @@ void WriteTerminal(std::vector<mpz_class> &encryptedMsg, const std::string &decr
     }
 }
 
-void _add_(const std::vector<mpz_class> &encryptedMsg, const std::string &convertedDecryptedMessage)
+void _add_(const BlockBatch &encryptedMsg, const std::string &convertedDecryptedMessage)
 {
 
     // ** .INI dosyasını oku
@@ -268,16 +74,19 @@ void _add_(const std::vector<mpz_class> &encryptedMsg, const std::string &conver
         std::string encryptedText;
         std::string encryptedTextHex;
 
-        for (const auto &num : encryptedMsg)
-        {
-        }
         std::cout << std::endl;
 
-        for (const auto &num : encryptedMsg)
+        mpz_t view;
+        for (size_t i = 0; i < encryptedMsg.Count(); ++i)
         { // ** Her bir sayıyı bir boşlukla ayırarak .ini dosyasına ekle & Hex türünde bellekte tut.
-            encryptedText += num.get_str() + " ";
+            mpz_srcptr num = encryptedMsg.View(i, view);
 
-            char *hexStr = mpz_get_str(NULL, 16, num.get_mpz_t());
+            char *decStr = mpz_get_str(NULL, 10, num);
+            encryptedText.append(decStr);
+            encryptedText.append(" ");
+            free(decStr);
+
+            char *hexStr = mpz_get_str(NULL, 16, num);
             // ** Hex türünde kaydet.
             encryptedTextHex.append(hexStr);
             encryptedTextHex.append(" ");
@@ -298,19 +107,19 @@ void _add_(const std::vector<mpz_class> &encryptedMsg, const std::string &conver
     }
 }
 
-void _main_(std::string &text, const mpz_class &publicGenerator, const mpz_class &publicKey, const mpz_class &privateKey)
+void _main_(std::string &text, const mpz_class &publicGenerator, const mpz_class &publicKey, const mpz_class &privateKey, BlindingPool *blinding)
 {
 
     try
     {
         // ** Metni ASCII dizesine çevir
-        std::vector<mpz_class> numbers = ConvertTextToNumbers(text);
+        BlockBatch numbers = ConvertTextToNumbers(text);
 
         // ** ASCII dizesinde ki metni şifrele
-        std::vector<mpz_class> encryptedMsg = Encrypt(numbers, publicGenerator, publicKey);
+        BlockBatch encryptedMsg = Encrypt(numbers, publicGenerator, publicKey);
 
         // ** Şifrelenmiş metni çöz
-        std::vector<mpz_class> decryptedMessage = Decrypt(encryptedMsg, privateKey, publicKey);
+        BlockBatch decryptedMessage = Decrypt(encryptedMsg, privateKey, publicKey, blinding);
 
         // ** Çözülmüş metni ASCII -> Char çevir.
         std::string convertedDecryptedMessage = ConvertNumbersToText(decryptedMessage);
@@ -327,7 +136,68 @@ void _main_(std::string &text, const mpz_class &publicGenerator, const mpz_class
     }
 }
 
-void _match_ini_items_(std::string &filename)
+void _hybrid_(std::string &text, const mpz_class &publicGenerator, const mpz_class &publicKey, const mpz_class &privateKey, BlindingPool *blinding)
+{
+    try
+    {
+        // ** Metni hibrit zarfa şifrele
+        std::istringstream plainStream(text);
+        std::ostringstream envelopeStream;
+        HybridEncryptStream(plainStream, envelopeStream, publicGenerator, publicKey);
+        std::string envelope = envelopeStream.str();
+
+        // ** Zarfı geri çöz
+        std::istringstream envelopeInput(envelope);
+        std::ostringstream decryptedStream;
+        HybridDecryptStream(envelopeInput, decryptedStream, privateKey, publicKey, blinding);
+
+        // ** Zarfı Hex olarak .INI dosyasına ekle
+        std::string envelopeHex = HybridToHex(envelope);
+
+        std::map<std::string, std::map<std::string, std::string>> iniData = ReadINI("Config.ini");
+        iniData["HybridText"]["Envelope"] = envelopeHex;
+        iniData["DecryptedText"]["Decrypted"] = decryptedStream.str();
+        WriteINI("Config.ini", iniData);
+
+        std::cout << "\n\n";
+        std::cout << "Hybrid Envelope (Hex): " << envelopeHex << std::endl;
+        std::cout << "Decrypted Text: " << decryptedStream.str() << std::endl;
+    }
+    catch (std::exception &ex)
+    {
+        OwnErr();
+    }
+}
+
+void _hybrid_file_(const std::string &mode, const std::string &inputPath, const std::string &outputPath,
+                   const mpz_class &publicGenerator, const mpz_class &publicKey, const mpz_class &privateKey, BlindingPool *blinding)
+{
+    try
+    {
+        std::ifstream input(inputPath, std::ios::binary);
+        std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+        if (!input.is_open() || !output.is_open())
+        {
+            std::cerr << "Unable to open file: " << (input.is_open() ? outputPath : inputPath) << std::endl;
+            return;
+        }
+
+        uint64_t bytes = 0;
+        if (mode == "--hybrid-encrypt")
+            bytes = HybridEncryptStream(input, output, publicGenerator, publicKey);
+        else
+            bytes = HybridDecryptStream(input, output, privateKey, publicKey, blinding);
+
+        std::cout << "Hybrid " << (mode == "--hybrid-encrypt" ? "encrypted " : "decrypted ") << bytes
+                  << " bytes: " << inputPath << " -> " << outputPath << std::endl;
+    }
+    catch (std::exception &ex)
+    {
+        OwnErr();
+    }
+}
+
+void _match_ini_items_(std::string &filename, const std::vector<std::string> &args)
 {
     try
     {
@@ -360,8 +230,19 @@ void _match_ini_items_(std::string &filename)
             std::cout << "Text: " << text << std::endl;
         }
 
+        // ** Özel anahtar işlemleri için körleme havuzu (arka planda dolar)
+        BlindingPool blinding(publicGenerator, publicKey);
+
         // ** Islemleri Baslat !
-        _main_(text, publicGenerator, publicKey, privateKey);
+        if (args.empty())
+            _main_(text, publicGenerator, publicKey, privateKey, &blinding);
+        else if (args[0] == "--hybrid")
+            _hybrid_(text, publicGenerator, publicKey, privateKey, &blinding);
+        else
+            _hybrid_file_(args[0], args[1], args[2], publicGenerator, publicKey, privateKey, &blinding);
+
+        std::cout << "Blinding Pool: " << blinding.Hits() << " hits, " << blinding.Misses() << " misses, "
+                  << blinding.Generated() << " pairs generated" << std::endl;
     }
     catch (std::exception &ex)
     {
@@ -369,8 +250,20 @@ void _match_ini_items_(std::string &filename)
     }
 }
 
-int main()
+int main(int argc, char *argv[])
 {
     std::string iniFilename = "Config.ini";
-    _match_ini_items_(iniFilename);
+    std::vector<std::string> args(argv + 1, argv + argc);
+
+    // ** Argümansız: klasik RSA. --hybrid: Text'i hibrit modda şifrele.
+    // ** --hybrid-encrypt / --hybrid-decrypt <girdi> <çıktı>: dosyayı hibrit modda işle.
+    bool validArgs = args.empty() || (args.size() == 1 && args[0] == "--hybrid") ||
+                     (args.size() == 3 && (args[0] == "--hybrid-encrypt" || args[0] == "--hybrid-decrypt"));
+    if (!validArgs)
+    {
+        std::cerr << "Usage: " << argv[0] << " [--hybrid | --hybrid-encrypt <input> <output> | --hybrid-decrypt <input> <output>]" << std::endl;
+        return 1;
+    }
+
+    _match_ini_items_(iniFilename, args);
 }
\ No newline at end of file
@@ -0,0 +1,359 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <memory>
+#include <cstdio>
+#include <gmp.h>
+#include <gmpxx.h>
+#include <algebra.h>    // ? GMP işlemlerini kısaltmak için.
+#include <configfile.h> // ? Anahtar dosyası (Config.INI biçimi)
+#include <hybrid.h>     // ? RSA-KEM + ChaCha20-Poly1305 hibrit mod
+#include <rsacore.h>    // ? EulerPhi, PrivateKey, Encrypt, Decrypt
+
+#if defined(_WIN32)
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+/*
+    RSABatch: Etkileşimsiz toplu işlem aracı.
+    Anahtar bir kez yüklenir, girdi akışındaki her kayıt aynı anahtarla işlenir ve sonuçlar stdout'a yazılır.
+    İşlem sonunda stderr'e toplam hız özeti basılır.
+
+    Kullanım:
+        RSABatch.exe [--key Config.ini] [--mode encrypt|decrypt|hybrid-encrypt|hybrid-decrypt]
+                     [--input <dosya>|-] [--delimiter newline|length] [--format hex|dec|raw]
+
+        --key      : [Private] PrimeOne/PrimeTwo ve [Public] Generator içeren anahtar dosyası. Default: Config.ini
+        --mode     : Her kayda uygulanacak işlem. Default: encrypt
+        --input    : Girdi dosyası; '-' stdin. Default: -
+        --delimiter: newline = her satır bir kayıt; length = 4 byte little-endian uzunluk + kayıt. Default: newline
+                     Çıktı kayıtları da aynı biçimde ayrılır.
+        --format   : Şifreli tarafın biçimi (encrypt çıktısı / decrypt girdisi). Default: hex
+                     hex, dec: boşlukla ayrılmış bloklar (Config.ini [EncryptedHex] / [EncryptedText] gibi)
+                     raw     : BlockBatch tamponu olduğu gibi (yerel limb düzeni); hibrit modlarda ham zarf.
+                               İkili veri satır sonu içerebileceğinden yalnızca --delimiter length ile kullanılır.
+*/
+
+/*
+    BatchOptions: Komut satırından okunan ayarlar.
+*/
+struct BatchOptions
+{
+    std::string keyFile = "Config.ini";
+    std::string mode = "encrypt";
+    std::string input = "-";
+    std::string delimiter = "newline";
+    std::string format = "hex";
+};
+
+/*
+    BatchKey: Bir kez türetilip tüm kayıtlarda kullanılan anahtar değerleri.
+        blinding: Özel anahtar işlemleri için körleme havuzu (main içinde oluşturulur).
+*/
+struct BatchKey
+{
+    mpz_class generator;
+    mpz_class publicKey;
+    mpz_class privateKey;
+    BlindingPool *blinding = nullptr;
+};
+
+/*
+    LoadKeyFile fonksiyonu anahtar dosyasını okur ve RSA değerlerini bir kez türetir.
+
+    Return Değeri:
+        bool: Dosya açılamazsa veya gerekli değerler yoksa false.
+*/
+bool LoadKeyFile(const std::string &filename, BatchKey &key)
+{
+    std::ifstream probe(filename);
+    if (!probe.is_open())
+    {
+        std::cerr << "Unable to open key file: " << filename << std::endl;
+        return false;
+    }
+    probe.close();
+
+    std::map<std::string, std::map<std::string, std::string>> iniData = ReadINI(filename);
+    if (iniData["Private"]["PrimeOne"].empty() || iniData["Private"]["PrimeTwo"].empty() || iniData["Public"]["Generator"].empty())
+    {
+        std::cerr << "Key file is missing [Private] PrimeOne/PrimeTwo or [Public] Generator: " << filename << std::endl;
+        return false;
+    }
+
+    mpz_class secretPrimeOne(iniData["Private"]["PrimeOne"]);
+    mpz_class secretPrimeTwo(iniData["Private"]["PrimeTwo"]);
+    key.generator = mpz_class(iniData["Public"]["Generator"]);
+
+    // ** EulerPhi asalları değiştirdiği için modül önce hesaplanır
+    key.publicKey = multiply(secretPrimeOne, secretPrimeTwo);
+    mpz_class phiResult = EulerPhi(secretPrimeOne, secretPrimeTwo);
+    key.privateKey = PrivateKey(phiResult, key.generator);
+
+    return true;
+}
+
+/*
+    ReadRecord / WriteRecord fonksiyonları kayıtları seçilen ayırıcıya göre okur ve yazar.
+    newline: satır sonundaki '\r' atılır. length: 4 byte little-endian uzunluk öneki.
+*/
+bool ReadRecord(std::istream &in, bool lengthDelimited, std::string &record)
+{
+    if (!lengthDelimited)
+    {
+        if (!std::getline(in, record))
+            return false;
+        if (!record.empty() && record.back() == '\r')
+            record.pop_back();
+        return true;
+    }
+
+    uint8_t prefix[4];
+    if (!in.read(reinterpret_cast<char *>(prefix), sizeof(prefix)))
+    {
+        if (in.gcount() != 0)
+            throw std::runtime_error("Truncated record length prefix.");
+        return false;
+    }
+
+    record.resize(ChaCha20Load32(prefix));
+    if (!in.read(&record[0], static_cast<std::streamsize>(record.size())))
+        throw std::runtime_error("Truncated record.");
+    return true;
+}
+
+void WriteRecord(std::ostream &out, bool lengthDelimited, const std::string &record)
+{
+    if (lengthDelimited)
+    {
+        uint8_t prefix[4];
+        ChaCha20Store32(prefix, static_cast<uint32_t>(record.size()));
+        out.write(reinterpret_cast<const char *>(prefix), sizeof(prefix));
+        out.write(record.data(), static_cast<std::streamsize>(record.size()));
+    }
+    else
+    {
+        out.write(record.data(), static_cast<std::streamsize>(record.size()));
+        out.put('\n');
+    }
+}
+
+/*
+    EncodeBlocks fonksiyonu şifreli blokları seçilen biçimde metne / byte dizisine çevirir.
+    raw biçimi BlockBatch tamponunu kopyalar (Data(), ByteSize()).
+*/
+std::string EncodeBlocks(const BlockBatch &blocks, const std::string &format)
+{
+    if (format == "raw")
+        return std::string(reinterpret_cast<const char *>(blocks.Data()), blocks.ByteSize());
+
+    int base = format == "dec" ? 10 : 16;
+    std::string text;
+    std::vector<char> digits;
+    mpz_t view;
+
+    for (size_t i = 0; i < blocks.Count(); ++i)
+    {
+        mpz_srcptr num = blocks.View(i, view);
+        digits.resize(mpz_sizeinbase(num, base) + 2);
+        mpz_get_str(digits.data(), base, num);
+
+        if (i > 0)
+            text += ' ';
+        text += digits.data();
+    }
+
+    return text;
+}
+
+// ** DecodeBlocks fonksiyonu EncodeBlocks çıktısını 'stride' genişliğinde bir BlockBatch'e geri çevirir.
+BlockBatch DecodeBlocks(const std::string &record, const std::string &format, size_t stride)
+{
+    if (format == "raw")
+    {
+        size_t blockBytes = stride * sizeof(mp_limb_t);
+        if (record.size() % blockBytes != 0)
+            throw std::runtime_error("Raw record size is not a multiple of the block size.");
+
+        BlockBatch blocks(record.size() / blockBytes, stride);
+        if (!record.empty())
+            std::memcpy(blocks.Data(), record.data(), record.size());
+        return blocks;
+    }
+
+    int base = format == "dec" ? 10 : 16;
+    std::vector<std::string> tokens;
+    std::istringstream stream(record);
+    std::string token;
+    while (stream >> token)
+        tokens.push_back(token);
+
+    BlockBatch blocks(tokens.size(), stride);
+    mpz_class value;
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        if (mpz_set_str(value.get_mpz_t(), tokens[i].c_str(), base) != 0)
+            throw std::runtime_error("Invalid number in record: " + tokens[i]);
+        blocks.Set(i, value.get_mpz_t());
+    }
+
+    return blocks;
+}
+
+/*
+    ProcessRecord fonksiyonu tek bir kaydı seçilen moda göre işler.
+
+    Return Değeri:
+        string: Çıktı kaydı (ayırıcı hariç).
+*/
+std::string ProcessRecord(std::string &record, const BatchOptions &options, const BatchKey &key)
+{
+    if (options.mode == "encrypt")
+    {
+        BlockBatch numbers = ConvertTextToNumbers(record);
+        return EncodeBlocks(Encrypt(numbers, key.generator, key.publicKey), options.format);
+    }
+
+    if (options.mode == "decrypt")
+    {
+        BlockBatch encrypted = DecodeBlocks(record, options.format, BlockBatch::StrideFor(key.publicKey));
+        return ConvertNumbersToText(Decrypt(encrypted, key.privateKey, key.publicKey, key.blinding));
+    }
+
+    if (options.mode == "hybrid-encrypt")
+    {
+        std::istringstream plain(record);
+        std::ostringstream envelope;
+        HybridEncryptStream(plain, envelope, key.generator, key.publicKey);
+        return options.format == "raw" ? envelope.str() : HybridToHex(envelope.str());
+    }
+
+    std::istringstream envelope(options.format == "raw" ? record : HybridFromHex(record));
+    std::ostringstream plain;
+    HybridDecryptStream(envelope, plain, key.privateKey, key.publicKey, key.blinding);
+    return plain.str();
+}
+
+void PrintUsage(const char *program)
+{
+    std::cerr << "Usage: " << program << " [--key Config.ini] [--mode encrypt|decrypt|hybrid-encrypt|hybrid-decrypt]"
+              << " [--input <file>|-] [--delimiter newline|length] [--format hex|dec|raw]" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    BatchOptions options;
+
+    // ** Komut satırı
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        if (arg == "--key")
+            options.keyFile = argv[++i];
+        else if (arg == "--mode")
+            options.mode = argv[++i];
+        else if (arg == "--input")
+            options.input = argv[++i];
+        else if (arg == "--delimiter")
+            options.delimiter = argv[++i];
+        else if (arg == "--format")
+            options.format = argv[++i];
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    bool validMode = options.mode == "encrypt" || options.mode == "decrypt" ||
+                     options.mode == "hybrid-encrypt" || options.mode == "hybrid-decrypt";
+    bool validFormat = options.format == "hex" || options.format == "raw" ||
+                       (options.format == "dec" && (options.mode == "encrypt" || options.mode == "decrypt"));
+    bool validDelimiter = options.delimiter == "length" || (options.delimiter == "newline" && options.format != "raw");
+    if (!validMode || !validFormat || !validDelimiter)
+    {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        // ** Anahtar bir kez yüklenir
+        BatchKey key;
+        if (!LoadKeyFile(options.keyFile, key))
+            return 1;
+
+        // ** Şifre çözme modlarında körleme havuzu arka planda doldurulur
+        std::unique_ptr<BlindingPool> blinding;
+        if (options.mode == "decrypt" || options.mode == "hybrid-decrypt")
+        {
+            blinding.reset(new BlindingPool(key.generator, key.publicKey));
+            key.blinding = blinding.get();
+        }
+
+#if defined(_WIN32)
+        _setmode(_fileno(stdin), _O_BINARY);
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        std::ios::sync_with_stdio(false);
+
+        std::ifstream inputFile;
+        if (options.input != "-")
+        {
+            inputFile.open(options.input, std::ios::binary);
+            if (!inputFile.is_open())
+            {
+                std::cerr << "Unable to open input file: " << options.input << std::endl;
+                return 1;
+            }
+        }
+        std::istream &in = options.input == "-" ? std::cin : inputFile;
+
+        bool lengthDelimited = options.delimiter == "length";
+        std::string record;
+        uint64_t records = 0;
+        uint64_t bytesIn = 0;
+        uint64_t bytesOut = 0;
+
+        auto start = std::chrono::steady_clock::now();
+
+        // ** Her kayıt aynı anahtarla işlenir
+        while (ReadRecord(in, lengthDelimited, record))
+        {
+            std::string result = ProcessRecord(record, options, key);
+            WriteRecord(std::cout, lengthDelimited, result);
+
+            ++records;
+            bytesIn += record.size();
+            bytesOut += result.size();
+        }
+        std::cout.flush();
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        double rate = seconds > 0 ? records / seconds : 0;
+        double throughput = seconds > 0 ? bytesIn / seconds / (1024 * 1024) : 0;
+
+        std::cerr << "Processed " << records << " records (" << bytesIn << " bytes in, " << bytesOut << " bytes out) in "
+                  << seconds << " s: " << rate << " records/s, " << throughput << " MiB/s" << std::endl;
+
+        if (blinding)
+            std::cerr << "Blinding pool: " << blinding->Hits() << " hits, " << blinding->Misses() << " misses, "
+                      << blinding->Generated() << " pairs generated" << std::endl;
+    }
+    catch (std::exception &ex)
+    {
+        OwnErr();
+    }
+
+    return 0;
+}